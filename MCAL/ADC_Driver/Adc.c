@@ -0,0 +1,347 @@
+/***************************************************************************
+ * @file    Adc.c
+ * @brief   Định nghĩa driver ADC quét liên tục bằng DMA double buffer
+ * @details ADC1 chạy scan + continuous, DMA1 Channel1 ở chế độ circular ghi
+ *          vào buffer gồm 2 nửa. Ngắt Half Transfer báo nửa đầu đầy, ngắt
+ *          Transfer Complete báo nửa sau đầy; nửa còn lại vẫn đang được DMA
+ *          ghi nên CPU luôn xử lý dữ liệu ổn định mà không phải chờ ADC.
+ * @version 1.0
+ * @date    18-06-2025
+ ***************************************************************************/
+
+#include "Adc.h"
+#include "Adc_Cfg.h"
+
+// Trạng thái driver
+static volatile Adc_StatusType AdcStatus = ADC_UNINIT;
+
+// Cấu hình đang dùng
+static const Adc_ConfigType *AdcConfig = NULL_PTR;
+
+// Chuỗi kênh ADC theo thứ tự rank, xây dựng từ cấu hình Port
+static uint8 AdcScanSequence[ADC_MAX_CHANNELS];
+static uint8 AdcChannelCount = 0;
+
+// Số mẫu trong một nửa buffer = SamplesPerChannel * AdcChannelCount
+static uint16 AdcHalfSize = 0;
+
+// ADC đang được cấp nguồn (ADON = 1) hay không
+static uint8 AdcPoweredUp = 0;
+
+// Double buffer DMA: [nửa đầu | nửa sau], mẫu xen kẽ theo thứ tự quét
+static volatile Adc_ValueType AdcDmaBuffer[2u * ADC_MAX_SAMPLES_PER_CHANNEL * ADC_MAX_CHANNELS];
+
+// Kết quả sau khi lọc của nửa buffer gần nhất
+static volatile Adc_ValueType AdcResult[ADC_MAX_CHANNELS];
+static volatile uint8 AdcResultValid = 0;
+
+/**
+ * @brief Xây dựng chuỗi quét regular từ các chân PORT_PIN_MODE_ADC
+ *
+ * @details Chân không nối tới kênh ADC1 hoặc kênh đã có trong chuỗi sẽ bị bỏ qua.
+ *
+ * @param PortConfig Cấu hình Port chứa các chân cần quét
+ * @param[out] Sequence Mảng nhận chuỗi kênh, tối thiểu ADC_MAX_CHANNELS phần tử
+ *
+ * @return Số kênh trong chuỗi
+ */
+static uint8 Adc_BuildScanSequence(const Port_ConfigType *PortConfig, uint8 *Sequence)
+{
+    uint8 count = 0;
+
+    for (uint16 i = 0; i < PortConfig->PortCfg_PinsCount; i++)
+    {
+        const Port_PinConfigType *pin = &PortConfig->PinCfgType[i];
+
+        if (pin->PinMode != PORT_PIN_MODE_ADC) continue;
+
+        uint8 channel = ADC_GET_CHANNEL(pin->PortID, pin->PinID % 16u);
+        if (channel == ADC_CHANNEL_INVALID) continue;
+
+        // Bỏ qua kênh trùng
+        uint8 duplicated = 0;
+        for (uint8 j = 0; j < count; j++)
+        {
+            if (Sequence[j] == channel)
+            {
+                duplicated = 1;
+                break;
+            }
+        }
+        if (duplicated) continue;
+
+        if (count >= ADC_MAX_CHANNELS) break;
+        Sequence[count++] = channel;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Xử lý một nửa buffer vừa đầy: lọc mẫu và gọi notification
+ *
+ * @param Half Nửa buffer cần xử lý
+ *
+ * @note Chạy trong ngắt DMA, phải xong trước khi DMA ghi hết nửa còn lại.
+ */
+static void Adc_ProcessHalf(Adc_BufferHalfType Half)
+{
+    const volatile Adc_ValueType *base = &AdcDmaBuffer[(uint16)Half * AdcHalfSize];
+    uint8 samples = AdcConfig->SamplesPerChannel;
+
+    if (AdcConfig->Filter == ADC_FILTER_NONE)
+    {
+        // Chỉ lấy vòng quét cuối cùng của nửa buffer
+        const volatile Adc_ValueType *last = &base[(uint16)(samples - 1u) * AdcChannelCount];
+        for (uint8 ch = 0; ch < AdcChannelCount; ch++)
+        {
+            AdcResult[ch] = last[ch];
+        }
+    }
+    else
+    {
+        uint32 sum[ADC_MAX_CHANNELS] = {0};
+
+        // Duyệt tuần tự theo địa chỉ bộ nhớ: từng vòng quét, từng kênh
+        for (uint8 s = 0; s < samples; s++)
+        {
+            for (uint8 ch = 0; ch < AdcChannelCount; ch++)
+            {
+                sum[ch] += *base++;
+            }
+        }
+
+        for (uint8 ch = 0; ch < AdcChannelCount; ch++)
+        {
+            if (AdcConfig->Filter == ADC_FILTER_OVERSAMPLE)
+                AdcResult[ch] = (Adc_ValueType)(sum[ch] >> AdcConfig->OversampleShift);
+            else
+                AdcResult[ch] = (Adc_ValueType)(sum[ch] / samples);
+        }
+    }
+
+    AdcResultValid = 1;
+
+    if (AdcConfig->Notification != NULL_PTR)
+    {
+        AdcConfig->Notification(Half);
+    }
+}
+
+/**
+ * @brief Cấp nguồn ADC1 (ADON = 1) và hiệu chuẩn
+ *
+ * @details Sau khi bật ADON, ADC cần tSTAB (tối đa 1us) để ổn định trước lần
+ *          chuyển đổi đầu tiên. Hiệu chuẩn kéo dài khoảng 83 chu kỳ ADCCLK
+ *          (~7us ở 12MHz) nên cũng đã phủ hết tSTAB, không cần chờ thêm.
+ *
+ * @note ADON phải đang bằng 0: ghi ADON = 1 khi ADC đã bật sẽ kích chuyển đổi.
+ */
+static void Adc_PowerUp(void)
+{
+    ADC_Cmd(ADC1, ENABLE);
+    AdcPoweredUp = 1;
+
+    ADC_ResetCalibration(ADC1);
+    while (ADC_GetResetCalibrationStatus(ADC1) == SET);
+    ADC_StartCalibration(ADC1);
+    while (ADC_GetCalibrationStatus(ADC1) == SET);
+}
+
+/**
+ * @brief Khởi tạo ADC1 + DMA1 Channel1 theo các chân ADC trong ConfigPtr->PortConfig
+ *
+ * @param ConfigPtr Con trỏ tới cấu hình driver ADC
+ */
+void Adc_Init(const Adc_ConfigType* ConfigPtr)
+{
+    ADC_InitTypeDef ADC_InitStruct;
+    DMA_InitTypeDef DMA_InitStruct;
+    uint8 sequence[ADC_MAX_CHANNELS];
+    uint8 count;
+
+    if (ConfigPtr == NULL_PTR) return;
+    if ((ConfigPtr->PortConfig == NULL_PTR) || (ConfigPtr->PortConfig->PinCfgType == NULL_PTR)) return;
+    if (AdcStatus == ADC_BUSY) return;
+
+    // Số mẫu mỗi nửa buffer phải nằm trong kích thước buffer tĩnh
+    if ((ConfigPtr->SamplesPerChannel == 0u) ||
+        (ConfigPtr->SamplesPerChannel > ADC_MAX_SAMPLES_PER_CHANNEL)) return;
+
+    // Xây dựng vào mảng tạm: cấu hình lỗi không được làm hỏng chuỗi quét đang dùng
+    count = Adc_BuildScanSequence(ConfigPtr->PortConfig, sequence);
+    if (count == 0u) return;
+
+    for (uint8 rank = 0; rank < count; rank++)
+    {
+        AdcScanSequence[rank] = sequence[rank];
+    }
+    AdcChannelCount = count;
+    AdcConfig   = ConfigPtr;
+    AdcHalfSize = (uint16)ConfigPtr->SamplesPerChannel * AdcChannelCount;
+    AdcResultValid = 0;
+
+    // Clock ADC tối đa 14MHz: PCLK2 72MHz / 6 = 12MHz
+    RCC_ADCCLKConfig(RCC_PCLK2_Div6);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1, ENABLE);
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+    // DMA: ADC1->DR -> AdcDmaBuffer, circular, ngắt nửa/đầy buffer
+    DMA_DeInit(DMA1_Channel1);
+    DMA_InitStruct.DMA_PeripheralBaseAddr = (uintptr_t)&ADC1->DR;
+    DMA_InitStruct.DMA_MemoryBaseAddr     = (uintptr_t)AdcDmaBuffer;
+    DMA_InitStruct.DMA_DIR                = DMA_DIR_PeripheralSRC;
+    DMA_InitStruct.DMA_BufferSize         = 2u * AdcHalfSize;
+    DMA_InitStruct.DMA_PeripheralInc      = DMA_PeripheralInc_Disable;
+    DMA_InitStruct.DMA_MemoryInc          = DMA_MemoryInc_Enable;
+    DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStruct.DMA_MemoryDataSize     = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStruct.DMA_Mode               = DMA_Mode_Circular;
+    DMA_InitStruct.DMA_Priority           = DMA_Priority_High;
+    DMA_InitStruct.DMA_M2M                = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel1, &DMA_InitStruct);
+    DMA_ITConfig(DMA1_Channel1, DMA_IT_HT | DMA_IT_TC, ENABLE);
+    NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+
+    // ADC: scan + continuous, kích bằng phần mềm
+    ADC_InitStruct.ADC_Mode               = ADC_Mode_Independent;
+    ADC_InitStruct.ADC_ScanConvMode       = ENABLE;
+    ADC_InitStruct.ADC_ContinuousConvMode = ENABLE;
+    ADC_InitStruct.ADC_ExternalTrigConv   = ADC_ExternalTrigConv_None;
+    ADC_InitStruct.ADC_DataAlign          = ADC_DataAlign_Right;
+    ADC_InitStruct.ADC_NbrOfChannel       = AdcChannelCount;
+    ADC_Init(ADC1, &ADC_InitStruct);
+
+    for (uint8 rank = 0; rank < AdcChannelCount; rank++)
+    {
+        ADC_RegularChannelConfig(ADC1, AdcScanSequence[rank], rank + 1u, ConfigPtr->SampleTime);
+    }
+
+    ADC_DMACmd(ADC1, ENABLE);
+    if (!AdcPoweredUp)
+    {
+        Adc_PowerUp();
+    }
+
+    AdcStatus = ADC_IDLE;
+}
+
+/**
+ * @brief Bắt đầu quét liên tục, DMA ghi lại từ đầu buffer
+ */
+void Adc_StartScan(void)
+{
+    if (AdcStatus != ADC_IDLE) return;
+
+    AdcResultValid = 0;
+
+    DMA_Cmd(DMA1_Channel1, DISABLE);
+    DMA_SetCurrDataCounter(DMA1_Channel1, 2u * AdcHalfSize);
+    DMA_ClearITPendingBit(DMA1_IT_GL1);
+    DMA_Cmd(DMA1_Channel1, ENABLE);
+
+    // Sau Adc_StopScan ADC đã bị tắt nguồn: chờ ổn định và hiệu chuẩn lại trước khi kích
+    if (!AdcPoweredUp)
+    {
+        Adc_PowerUp();
+    }
+
+    AdcStatus = ADC_BUSY;
+    ADC_SoftwareStartConvCmd(ADC1, ENABLE);
+}
+
+/**
+ * @brief Dừng quét liên tục
+ *
+ * @details Ở chế độ continuous, cách duy nhất để dừng ngay ADC là tắt ADON.
+ *          Adc_StartScan sẽ cấp nguồn và hiệu chuẩn lại trước khi quét tiếp.
+ */
+void Adc_StopScan(void)
+{
+    if (AdcStatus != ADC_BUSY) return;
+
+    ADC_Cmd(ADC1, DISABLE);
+    AdcPoweredUp = 0;
+    DMA_Cmd(DMA1_Channel1, DISABLE);
+
+    AdcStatus = ADC_IDLE;
+}
+
+/**
+ * @brief Lấy số kênh trong chuỗi quét
+ */
+uint8 Adc_GetChannelCount(void)
+{
+    return AdcChannelCount;
+}
+
+/**
+ * @brief Đọc kết quả mới nhất của toàn bộ chuỗi quét
+ *
+ * @details Ngắt DMA bị tạm khóa trong lúc copy để các kênh thuộc cùng một nửa buffer.
+ */
+Std_ReturnType Adc_ReadGroup(Adc_ValueType* DataBufferPtr)
+{
+    if (DataBufferPtr == NULL_PTR) return E_NOT_OK;
+    if (AdcStatus == ADC_UNINIT) return E_NOT_OK;
+    if (!AdcResultValid) return E_NOT_OK;
+
+    NVIC_DisableIRQ(DMA1_Channel1_IRQn);
+    for (uint8 ch = 0; ch < AdcChannelCount; ch++)
+    {
+        DataBufferPtr[ch] = AdcResult[ch];
+    }
+    NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+
+    return E_OK;
+}
+
+/**
+ * @brief Lấy con trỏ tới nửa buffer DMA thô
+ */
+const Adc_ValueType* Adc_GetRawBuffer(Adc_BufferHalfType Half)
+{
+    if (AdcStatus == ADC_UNINIT) return NULL_PTR;
+
+    return (const Adc_ValueType *)&AdcDmaBuffer[(uint16)Half * AdcHalfSize];
+}
+
+/**
+ * @brief Lấy trạng thái driver
+ */
+Adc_StatusType Adc_GetStatus(void)
+{
+    return AdcStatus;
+}
+
+/**
+ * @brief Trả về thông tin phiên bản của module.
+ */
+void Adc_GetVersionInfo(Std_VersionInfoType* VersionInfo)
+{
+    if (VersionInfo == NULL_PTR) return;
+
+    VersionInfo->vendorID = ADC_VENDOR_ID;
+    VersionInfo->moduleID = ADC_MODULE_ID;
+    VersionInfo->sw_major_version = ADC_SW_MAJOR_VERSION;
+    VersionInfo->sw_minor_version = ADC_SW_MINOR_VERSION;
+    VersionInfo->sw_patch_version = ADC_SW_PATCH_VERSION;
+}
+
+/**
+ * @brief Ngắt DMA1 Channel1: Half Transfer -> nửa đầu, Transfer Complete -> nửa sau
+ */
+void DMA1_Channel1_IRQHandler(void)
+{
+    if (DMA_GetITStatus(DMA1_IT_HT1) != RESET)
+    {
+        DMA_ClearITPendingBit(DMA1_IT_HT1);
+        Adc_ProcessHalf(ADC_BUFFER_HALF_FIRST);
+    }
+
+    if (DMA_GetITStatus(DMA1_IT_TC1) != RESET)
+    {
+        DMA_ClearITPendingBit(DMA1_IT_TC1);
+        Adc_ProcessHalf(ADC_BUFFER_HALF_SECOND);
+    }
+}
@@ -0,0 +1,147 @@
+/***************************************************************************
+ * @file    Adc.h
+ * @brief   Giao diện driver ADC quét liên tục bằng DMA cho STM32F1
+ * @details Driver tự xây dựng chuỗi quét regular từ tất cả các chân được cấu
+ *          hình PORT_PIN_MODE_ADC trong Port_Cfg, sau đó cho ADC1 chạy liên
+ *          tục và DMA1 Channel1 ghi vòng vào một double buffer. Mỗi khi một
+ *          nửa buffer đầy, driver (tùy chọn) lấy trung bình/oversampling và
+ *          gọi notification, CPU không phải chờ chuyển đổi.
+ * @version 1.0
+ * @date    18-06-2025
+ ***************************************************************************/
+
+#ifndef ADC_H
+#define ADC_H
+
+#include "Std_Type.h"
+#include "stm32f10x.h"
+#include "stm32f10x_adc.h"
+#include "stm32f10x_dma.h"
+#include "stm32f10x_rcc.h"
+#include "Port.h"
+
+/// @brief Giá trị kết quả chuyển đổi (12 bit, hoặc tới 16 bit khi oversampling)
+typedef uint16 Adc_ValueType;
+
+/// @brief Chỉ số kênh trong chuỗi quét (0 .. Adc_GetChannelCount() - 1)
+typedef uint8 Adc_ChannelType;
+
+/// @brief Nửa buffer DMA vừa được ghi đầy
+typedef enum {
+    ADC_BUFFER_HALF_FIRST  = 0x00,  ///< Nửa đầu (DMA Half Transfer)
+    ADC_BUFFER_HALF_SECOND = 0x01   ///< Nửa sau (DMA Transfer Complete)
+} Adc_BufferHalfType;
+
+/// @brief Kiểu xử lý mẫu trên mỗi nửa buffer
+typedef enum {
+    ADC_FILTER_NONE       = 0x00,   ///< Lấy mẫu cuối cùng của nửa buffer
+    ADC_FILTER_AVERAGE    = 0x01,   ///< Trung bình cộng các mẫu trong nửa buffer
+    ADC_FILTER_OVERSAMPLE = 0x02    ///< Cộng dồn rồi dịch phải OversampleShift bit
+} Adc_FilterType;
+
+/// @brief Trạng thái driver
+typedef enum {
+    ADC_UNINIT = 0x00,  ///< Chưa khởi tạo
+    ADC_IDLE   = 0x01,  ///< Đã khởi tạo, chưa quét
+    ADC_BUSY   = 0x02   ///< Đang quét liên tục
+} Adc_StatusType;
+
+/// @brief Hàm notification được gọi trong ngắt DMA khi một nửa buffer đầy
+typedef void (*Adc_NotificationType)(Adc_BufferHalfType Half);
+
+/// @brief Cấu hình tổng của driver ADC
+typedef struct
+{
+    const Port_ConfigType *PortConfig;  ///< Cấu hình Port dùng để tìm các chân PORT_PIN_MODE_ADC
+    uint8 SampleTime;                   ///< ADC_SampleTime_xCycles5 áp dụng cho mọi kênh
+    uint8 SamplesPerChannel;            ///< Số mẫu mỗi kênh trong một nửa buffer (1..ADC_MAX_SAMPLES_PER_CHANNEL)
+    Adc_FilterType Filter;              ///< Xử lý mẫu khi một nửa buffer đầy
+    uint8 OversampleShift;              ///< Số bit dịch phải khi Filter = ADC_FILTER_OVERSAMPLE
+    Adc_NotificationType Notification;  ///< Callback nửa/đầy buffer, NULL_PTR nếu không dùng
+} Adc_ConfigType;
+
+/// @name Định nghĩa là Driver version
+#define ADC_VENDOR_ID    1001u
+#define ADC_MODULE_ID    123u
+#define ADC_SW_MAJOR_VERSION 1u
+#define ADC_SW_MINOR_VERSION 0u
+#define ADC_SW_PATCH_VERSION 0u
+
+/// @brief Số kênh tối đa trong chuỗi regular của STM32F1
+#define ADC_MAX_CHANNELS                16u
+
+/// @brief Số mẫu tối đa mỗi kênh trong một nửa buffer
+#define ADC_MAX_SAMPLES_PER_CHANNEL     16u
+
+/// @brief Giá trị trả về khi chân không nối tới kênh ADC nào
+#define ADC_CHANNEL_INVALID             0xFFu
+
+/**
+ * @brief Ánh xạ (PortID, số chân) sang kênh ADC1 của STM32F103
+ * @details PA0..PA7 -> kênh 0..7, PB0..PB1 -> kênh 8..9, PC0..PC5 -> kênh 10..15
+ */
+#define ADC_GET_CHANNEL(PortID, Pin)  ((((PortID) == PORT_ID_A) && ((Pin) < 8u)) ? (Pin) : \
+                                       (((PortID) == PORT_ID_B) && ((Pin) < 2u)) ? ((Pin) + 8u) : \
+                                       (((PortID) == PORT_ID_C) && ((Pin) < 6u)) ? ((Pin) + 10u) : \
+                                       ADC_CHANNEL_INVALID)
+
+//==============================================================================
+//                              API FUNCTIONS
+//==============================================================================
+
+/**
+ * @brief Khởi tạo ADC1 + DMA1 Channel1 theo các chân ADC trong ConfigPtr->PortConfig
+ * @param ConfigPtr Con trỏ tới cấu hình driver ADC
+ *
+ * @note Port_Init phải được gọi trước để các chân đã ở chế độ analog.
+ */
+void Adc_Init(const Adc_ConfigType* ConfigPtr);
+
+/**
+ * @brief Bắt đầu quét liên tục (ADC continuous + DMA circular)
+ */
+void Adc_StartScan(void);
+
+/**
+ * @brief Dừng quét liên tục
+ */
+void Adc_StopScan(void);
+
+/**
+ * @brief Lấy số kênh trong chuỗi quét đã được xây dựng lúc Adc_Init
+ */
+uint8 Adc_GetChannelCount(void);
+
+/**
+ * @brief Đọc kết quả mới nhất (sau khi lọc) của toàn bộ chuỗi quét
+ *
+ * @param[out] DataBufferPtr Mảng nhận kết quả, tối thiểu Adc_GetChannelCount() phần tử
+ *
+ * @return E_OK nếu đã có ít nhất một nửa buffer được xử lý, ngược lại E_NOT_OK
+ */
+Std_ReturnType Adc_ReadGroup(Adc_ValueType* DataBufferPtr);
+
+/**
+ * @brief Lấy con trỏ tới nửa buffer DMA thô (mẫu xen kẽ theo thứ tự quét)
+ *
+ * @param[in] Half Nửa buffer cần lấy
+ *
+ * @return Con trỏ tới SamplesPerChannel * Adc_GetChannelCount() mẫu
+ *
+ * @note Chỉ nên đọc trong notification của đúng nửa đó, trước khi DMA ghi đè.
+ */
+const Adc_ValueType* Adc_GetRawBuffer(Adc_BufferHalfType Half);
+
+/**
+ * @brief Lấy trạng thái driver
+ */
+Adc_StatusType Adc_GetStatus(void);
+
+/**
+ * @brief Lấy thông tin version của module Adc
+ *
+ * @param[in,out] VersionInfo Con trỏ đến biến chứa thông tin version.
+ */
+void Adc_GetVersionInfo(Std_VersionInfoType* VersionInfo);
+
+#endif /* ADC_H */
@@ -0,0 +1,11 @@
+#include "Adc_Cfg.h"
+#include "Port_Cfg.h"
+
+const Adc_ConfigType Adc_Config = {
+    .PortConfig = &Port_Config,
+    .SampleTime = ADC_SampleTime_55Cycles5,
+    .SamplesPerChannel = 16,            // 16 mẫu mỗi kênh trong một nửa buffer
+    .Filter = ADC_FILTER_OVERSAMPLE,    // 16 mẫu = 4^2 -> thêm 2 bit, kết quả 14 bit
+    .OversampleShift = 2,
+    .Notification = NULL_PTR
+};
@@ -0,0 +1,20 @@
+/***********************************************************
+ *  @file    Adc_Cfg.h
+ *  @brief   ADC Driver Configuration Header File
+ *  @details File này chứa cấu hình driver ADC theo chuẩn
+ *           AUTOSAR, dùng trên STM32F103 với thư viện SPL.
+ *           Danh sách kênh được lấy từ các chân
+ *           PORT_PIN_MODE_ADC trong Port_Cfg.
+ ***********************************************************/
+
+#ifndef ADC_CFG_H
+#define ADC_CFG_H
+
+#include "Adc.h"  /* Bao gồm các kiểu dữ liệu của ADC Driver */
+
+/***********************************************************
+ * Cấu hình quét ADC (định nghĩa cụ thể ở Adc_Cfg.c)
+ ***********************************************************/
+extern const Adc_ConfigType Adc_Config;
+
+#endif /* ADC_CFG_H */
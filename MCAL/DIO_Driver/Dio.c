@@ -7,9 +7,35 @@
  ***************************************************************************/
 
 #include "Dio.h"
+#include "Dio_Cfg.h"
 #include "Det.h"  // Dùng để báo lỗi DET (nếu bật)
 #include "stm32f10x.h"
 
+#if (DIO_EDGE_EVENT_SUPPORT == STD_ON)
+
+#if ((DIO_EDGE_QUEUE_SIZE & (DIO_EDGE_QUEUE_SIZE - 1u)) != 0u)
+#error "DIO_EDGE_QUEUE_SIZE phai la luy thua cua 2"
+#endif
+
+#define DIO_EDGE_QUEUE_MASK     (DIO_EDGE_QUEUE_SIZE - 1u)
+
+/* Line EXTI dùng chung một IRQ */
+#define DIO_EXTI_LINES_9_5      0x03E0u
+#define DIO_EXTI_LINES_15_10    0xFC00u
+
+/*
+ * Hàng đợi sự kiện cạnh một bên ghi / một bên đọc, không khóa:
+ * chỉ ISR EXTI tăng Head, chỉ Dio_ReadEdgeEvents tăng Tail. Các ISR EXTI
+ * cùng mức ưu tiên (PORT_EXTI_IRQ_PRIORITY) nên không chen ngang nhau.
+ * Head/Tail chạy tự do, chỉ lấy mask khi truy cập mảng.
+ */
+static Dio_EdgeEventType DioEdgeQueue[DIO_EDGE_QUEUE_SIZE];
+static volatile uint16 DioEdgeHead = 0;
+static volatile uint16 DioEdgeTail = 0;
+static volatile uint32 DioEdgeOverflow = 0;
+
+#endif /* DIO_EDGE_EVENT_SUPPORT */
+
 /**
  * @brief      Đọc mức logic của kênh DIO được chỉ định.
  * @details    Hàm này đọc trạng thái (STD_HIGH hoặc STD_LOW) của một chân DIO.
@@ -110,7 +136,8 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 
 /**
  * @brief      Đọc toàn bộ trạng thái logic của một port.
- * @details    Trả về giá trị mức logic của tất cả các chân trong port.
+ * @details    Trả về giá trị mức logic của tất cả các chân trong port,
+ *             đọc một lần từ thanh ghi IDR (mức thực tế trên chân).
  *
  * @param[in]  PortId  ID của port cần đọc (VD: DIO_GPIO_PORT_A...)
  *
@@ -139,7 +166,7 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
         case 3: GET_PORT = GPIOD; break;
     }
 
-    retVal = (Dio_PortLevelType)(GPIO_ReadOutputData(GET_PORT));
+    retVal = (Dio_PortLevelType)(GPIO_ReadInputData(GET_PORT));
     return retVal;
 }
 
@@ -169,7 +196,7 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
 
 /**
  * @brief      Đọc trạng thái của một nhóm kênh DIO liền kề.
- * @details    Trả về giá trị nhóm sau khi đã dịch offset về bit thấp nhất.
+ * @details    Đọc IDR một lần, trả về giá trị nhóm sau khi đã dịch offset về bit thấp nhất.
  *
  * @param[in]  ChannelGroupIdPtr  Con trỏ tới cấu trúc nhóm kênh.
  *
@@ -181,10 +208,10 @@ Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupI
 
     if (ChannelGroupIdPtr == NULL_PTR) return STD_LOW;
 
-    GET_PORT = DIO_GET_PORT_ID(ChannelGroupIdPtr->port);
+    GET_PORT = DIO_GET_PORT_BY_INDEX(ChannelGroupIdPtr->port);
     if (GET_PORT == NULL_PTR) return STD_LOW;
 
-    uint16_t value = GPIO_ReadOutputData(GET_PORT);
+    uint16_t value = GPIO_ReadInputData(GET_PORT);
     uint16_t group_value = (value & ChannelGroupIdPtr->mask) >> ChannelGroupIdPtr->offset;
 
     return (Dio_PortLevelType)group_value;
@@ -192,7 +219,9 @@ Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupI
 
 /**
  * @brief      Ghi mức logic cho nhóm kênh DIO.
- * @details    Chỉ những bit nằm trong mask mới bị thay đổi.
+ * @details    Chỉ những bit nằm trong mask mới bị thay đổi. Bit cần set và bit
+ *             cần reset được ghi cùng lúc bằng một lần ghi BSRR, không
+ *             read-modify-write nên không xung đột với ngắt ghi cùng port.
  *
  * @param[in]  ChannelGroupIdPtr  Con trỏ đến cấu hình nhóm kênh.
  * @param[in]  Level              Giá trị logic cần ghi (bit thấp nhất ứng với offset).
@@ -203,15 +232,14 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_Po
 
     if (ChannelGroupIdPtr == NULL_PTR) return;
 
-    GET_PORT = DIO_GET_PORT_ID(ChannelGroupIdPtr->port);
+    GET_PORT = DIO_GET_PORT_BY_INDEX(ChannelGroupIdPtr->port);
     if (GET_PORT == NULL_PTR) return;
 
-    uint16_t port_value = GPIO_ReadOutputData(GET_PORT);
-
-    port_value &= ~(ChannelGroupIdPtr->mask);
-    port_value |= ((Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask);
+    uint16_t set_bits   = (uint16_t)((Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask);
+    uint16_t reset_bits = (uint16_t)(ChannelGroupIdPtr->mask & ~set_bits);
 
-    GPIO_Write(GET_PORT, port_value);
+    // BSRR: 16 bit thấp = set, 16 bit cao = reset
+    GET_PORT->BSRR = ((uint32_t)reset_bits << 16) | set_bits;
 }
 
 /**
@@ -253,3 +281,138 @@ void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortL
     port_val = (port_val & ~Mask) | (Level & Mask);
     GPIO_Write(GET_PORT, port_val);
 }
+
+/**
+ * @brief      Khởi tạo hàng đợi sự kiện cạnh.
+ * @details    Xóa hàng đợi, bộ đếm tràn và bật nguồn timestamp
+ *             (DIO_EDGE_TIMESTAMP_INIT) để sự kiện đầu tiên đã có thời điểm đúng.
+ *
+ * @note       Gọi trước Port_Init: khi đó chưa line EXTI nào được bật nên
+ *             ISR không thể chạy xen vào lúc Head/Tail đang bị xóa.
+ */
+void Dio_Init(void)
+{
+#if (DIO_EDGE_EVENT_SUPPORT == STD_ON)
+    DioEdgeHead = 0;
+    DioEdgeTail = 0;
+    DioEdgeOverflow = 0;
+
+    DIO_EDGE_TIMESTAMP_INIT();
+#endif
+}
+
+#if (DIO_EDGE_EVENT_SUPPORT == STD_ON)
+
+/**
+ * @brief      Lấy các sự kiện cạnh khỏi hàng đợi theo lô.
+ * @details    Copy tối đa MaxEvents sự kiện theo thứ tự xảy ra rồi trả chỗ cho ISR.
+ *
+ * @param[out] EventsPtr  Mảng nhận sự kiện.
+ * @param[in]  MaxEvents  Số phần tử tối đa của mảng.
+ *
+ * @return     Số sự kiện đã lấy.
+ *
+ * @note       Chỉ được gọi từ một task duy nhất.
+ */
+uint8 Dio_ReadEdgeEvents(Dio_EdgeEventType* EventsPtr, uint8 MaxEvents)
+{
+    uint16 tail = DioEdgeTail;
+    uint16 count;
+
+    if (EventsPtr == NULL_PTR) return 0;
+
+    count = (uint16)(DioEdgeHead - tail);
+    __DMB();  // Đọc Head trước khi đọc dữ liệu ISR đã ghi
+
+    if (count > MaxEvents) count = MaxEvents;
+
+    for (uint16 i = 0; i < count; i++)
+    {
+        EventsPtr[i] = DioEdgeQueue[(uint16)(tail + i) & DIO_EDGE_QUEUE_MASK];
+    }
+
+    __DMB();  // Copy xong mới trả chỗ cho ISR
+    DioEdgeTail = (uint16)(tail + count);
+
+    return (uint8)count;
+}
+
+/**
+ * @brief      Trả về số sự kiện cạnh bị bỏ do hàng đợi đầy.
+ */
+uint32 Dio_GetEdgeEventOverflowCount(void)
+{
+    return DioEdgeOverflow;
+}
+
+/**
+ * @brief      Xử lý mọi line EXTI đang pending trong nhóm Lines.
+ * @details    Đọc thanh ghi PR một lần, xóa cờ một lần, sau đó duyệt từng bit
+ *             pending. Port của mỗi line lấy từ AFIO_EXTICR, cạnh lấy từ
+ *             RTSR/FTSR. Line bắt cả hai cạnh báo DIO_EDGE_BOTH vì một cờ
+ *             pending có thể đại diện cho cả xung lên-xuống đã kết thúc;
+ *             mức chân hiện tại luôn được ghi vào Level.
+ *
+ * @param[in]  Lines  Mặt nạ các line EXTI thuộc IRQ đang chạy.
+ */
+static void Dio_EdgeDispatch(uint32 Lines)
+{
+    uint32 pending = EXTI->PR & Lines;
+    uint32 timestamp;
+    uint32 rising;
+    uint32 falling;
+
+    if (pending == 0u) return;
+
+    EXTI_ClearITPendingBit(pending);  // Một lần ghi 1 vào PR xóa mọi line đã đọc
+    timestamp = DIO_EDGE_TIMESTAMP();
+    rising  = EXTI->RTSR;
+    falling = EXTI->FTSR;
+
+    while (pending != 0u)
+    {
+        uint8 line = (uint8)__CLZ(__RBIT(pending));  // Bit thấp nhất đang pending
+        uint32 bit = pending & (0u - pending);
+        pending &= pending - 1u;
+
+        uint8 port = (uint8)((AFIO->EXTICR[line >> 2] >> ((line & 0x03u) * 4u)) & 0x0Fu);
+        Dio_ChannelType channel = (Dio_ChannelType)((port * 16u) + line);
+        GPIO_TypeDef *GET_PORT = DIO_GET_PORT_ID(channel);
+        Dio_EdgeType edge;
+
+        if (GET_PORT == NULL_PTR) continue;
+
+        if ((rising & bit) && (falling & bit))
+        {
+            edge = DIO_EDGE_BOTH;
+        }
+        else
+        {
+            edge = (rising & bit) ? DIO_EDGE_RISING : DIO_EDGE_FALLING;
+        }
+
+        uint16 head = DioEdgeHead;
+        if ((uint16)(head - DioEdgeTail) >= DIO_EDGE_QUEUE_SIZE)
+        {
+            DioEdgeOverflow++;
+            continue;
+        }
+
+        DioEdgeQueue[head & DIO_EDGE_QUEUE_MASK].Timestamp = timestamp;
+        DioEdgeQueue[head & DIO_EDGE_QUEUE_MASK].Channel   = channel;
+        DioEdgeQueue[head & DIO_EDGE_QUEUE_MASK].Edge      = edge;
+        DioEdgeQueue[head & DIO_EDGE_QUEUE_MASK].Level     = (GET_PORT->IDR & bit) ? STD_HIGH : STD_LOW;
+        __DMB();  // Ghi dữ liệu trước khi công bố Head mới
+        DioEdgeHead = (uint16)(head + 1u);
+    }
+}
+
+void EXTI0_IRQHandler(void)     { Dio_EdgeDispatch(0x0001u); }
+void EXTI1_IRQHandler(void)     { Dio_EdgeDispatch(0x0002u); }
+void EXTI2_IRQHandler(void)     { Dio_EdgeDispatch(0x0004u); }
+void EXTI3_IRQHandler(void)     { Dio_EdgeDispatch(0x0008u); }
+void EXTI4_IRQHandler(void)     { Dio_EdgeDispatch(0x0010u); }
+void EXTI9_5_IRQHandler(void)   { Dio_EdgeDispatch(DIO_EXTI_LINES_9_5); }
+void EXTI15_10_IRQHandler(void) { Dio_EdgeDispatch(DIO_EXTI_LINES_15_10); }
+
+#endif /* DIO_EDGE_EVENT_SUPPORT */
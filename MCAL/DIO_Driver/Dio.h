@@ -16,6 +16,12 @@ typedef uint8 Dio_ChannelType;  // Use uint8 if < 256 channels, else uint16 (48
 
 typedef uint8 Dio_PortType;  // Được sử dụng để chỉ định cụ thể loại port A,B,C,D
 
+/*--------------------------------------------------
+ * Dio_PortLevelType Definition
+ * @details Sẽ in ra tất các giá trị của 1 groupt A,B,C,D dưới dạng 0 1,và phải kiểu dữ liệu phải cover groupt lớn nhất
+ *--------------------------------------------------*/
+typedef uint16 Dio_PortLevelType;
+
 /*--------------------------------------------------
  * Dio_ChannelGroupType Definition
  * @brief
@@ -23,7 +29,7 @@ typedef uint8 Dio_PortType;  // Được sử dụng để chỉ định cụ th
  *--------------------------------------------------*/
 typedef struct
 {
-    uint8 mask;         //This element mask which defines the positions of the channel group.
+    Dio_PortLevelType mask; //This element mask which defines the positions of the channel group.
     uint8 offset;       //This element shall be the position of the Channel Group on the port,counted from the LSB.
     Dio_PortType port;
 } Dio_ChannelGroupType; //This shall be the port on which the Channel group is defined
@@ -33,18 +39,39 @@ typedef struct
  * @details Là mức điện áp của GPIO
  *--------------------------------------------------*/
 typedef uint8 Dio_LevelType;
-
-/*--------------------------------------------------
- * Dio_PortLevelType Definition
- * @details Sẽ in ra tất các giá trị của 1 groupt A,B,C,D dưới dạng 0 1,và phải kiểu dữ liệu phải cover groupt lớn nhất
- *--------------------------------------------------*/
-typedef uint16 Dio_PortLevelType;
 /*--------------------------------------------------
  * Giá trị hợp lệ cho Dio_LevelType (Range)
  *--------------------------------------------------*/
 #define STD_LOW     0x00U  // Mức điện áp 0V (Logic 0)
 #define STD_HIGH    0x01U  // Mức điện áp 5V/3.3V (Logic 1)
 
+/*--------------------------------------------------
+ * Dio_EdgeType Definition
+ * @details Cạnh tín hiệu của một sự kiện EXTI
+ * @note    Line bắt cả hai cạnh (PORT_PIN_EDGE_BOTH) chỉ có một cờ pending:
+ *          xung ngắn hơn độ trễ ngắt (lên rồi xuống trước khi ISR chạy) chỉ
+ *          sinh một sự kiện. Khi đó không thể biết cạnh nào đã xảy ra nên sự
+ *          kiện mang DIO_EDGE_BOTH, mức chân lúc ISR đọc nằm trong Level.
+ *--------------------------------------------------*/
+typedef enum
+{
+    DIO_EDGE_RISING  = 0x01,    // Cạnh lên
+    DIO_EDGE_FALLING = 0x02,    // Cạnh xuống
+    DIO_EDGE_BOTH    = 0x03     // Có ít nhất một cạnh, không rõ hướng (line bắt cả hai cạnh)
+} Dio_EdgeType;
+
+/*--------------------------------------------------
+ * Dio_EdgeEventType Definition
+ * @details Một sự kiện cạnh do ISR EXTI đẩy vào hàng đợi
+ *--------------------------------------------------*/
+typedef struct
+{
+    uint32 Timestamp;           // Thời điểm vào ISR (DIO_EDGE_TIMESTAMP)
+    Dio_ChannelType Channel;    // Kênh DIO sinh sự kiện
+    Dio_EdgeType Edge;          // Cạnh lên, xuống hoặc DIO_EDGE_BOTH
+    Dio_LevelType Level;        // Mức chân lúc ISR đọc IDR
+} Dio_EdgeEventType;
+
 /*--------------------------------------------------
  * Mô tả (Description):
  * - Dio_LevelType đại diện cho trạng thái vật lý của chân DIO (input/output).
@@ -73,9 +100,19 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
                                     ((ChannelId) < 64) ? GPIOD : \
                                     NULL_PTR)
 
+/*Lấy port theo chỉ số port (GPIO_PORT_x)*/
+#define DIO_GET_PORT_BY_INDEX(PortId)  (((PortId) == GPIO_PORT_A) ? GPIOA : \
+                                        ((PortId) == GPIO_PORT_B) ? GPIOB : \
+                                        ((PortId) == GPIO_PORT_C) ? GPIOC : \
+                                        ((PortId) == GPIO_PORT_D) ? GPIOD : \
+                                        NULL_PTR)
 
 /*Lấy pin của ChanelID*/
 #define DIO_GET_PIN_NUM(ChannelId)  (1 << ((ChannelId) % 16))
+
+/*Lấy chỉ số port (GPIO_PORT_x) và số thứ tự chân (0-15) của ChanelID*/
+#define DIO_GET_PORT_INDEX(ChannelId)   ((Dio_PortType)((ChannelId) / 16))
+#define DIO_GET_PIN_INDEX(ChannelId)    ((uint8)((ChannelId) % 16))
  /*--------------------------------------------------
  * Function Dio_WriteChannel
  *--------------------------------------------------*/
@@ -109,4 +146,22 @@ void Dio_GetVersionInfo (Std_VersionInfoType* VersionInfo);
  * Function Dio_MaskedWritePort
  *--------------------------------------------------*/
 void Dio_MaskedWritePort (Dio_PortType PortId,Dio_PortLevelType Level,Dio_PortLevelType Mask);
+ /*--------------------------------------------------
+ * Function Dio_Init
+ * Xóa hàng đợi sự kiện cạnh và bật nguồn timestamp,
+ * phải gọi trước Port_Init (trước khi line EXTI được bật)
+ *--------------------------------------------------*/
+void Dio_Init (void);
+ /*--------------------------------------------------
+ * Function Dio_ReadEdgeEvents
+ * Lấy tối đa MaxEvents sự kiện cạnh khỏi hàng đợi, trả về số sự kiện đã lấy
+ * (chỉ có khi DIO_EDGE_EVENT_SUPPORT == STD_ON)
+ *--------------------------------------------------*/
+uint8 Dio_ReadEdgeEvents (Dio_EdgeEventType* EventsPtr,uint8 MaxEvents);
+ /*--------------------------------------------------
+ * Function Dio_GetEdgeEventOverflowCount
+ * Số sự kiện bị bỏ do hàng đợi đầy
+ * (chỉ có khi DIO_EDGE_EVENT_SUPPORT == STD_ON)
+ *--------------------------------------------------*/
+uint32 Dio_GetEdgeEventOverflowCount (void);
 #endif /* DIO_H */
\ No newline at end of file
@@ -0,0 +1,54 @@
+/***********************************************************
+ *  @file    Dio_Cfg.h
+ *  @brief   DIO Driver Configuration Header File
+ *  @details File này chứa cấu hình hàng đợi sự kiện cạnh
+ *           (EXTI) của driver Dio, dùng trên STM32F103
+ *           với thư viện SPL.
+ ***********************************************************/
+
+#ifndef DIO_CFG_H
+#define DIO_CFG_H
+
+#include "Std_Type.h"
+#include "stm32f10x.h"
+
+/***********************************************************
+ * Bật/tắt hàng đợi sự kiện cạnh. Khi STD_ON, Dio định nghĩa
+ * EXTI0..EXTI4, EXTI9_5 và EXTI15_10_IRQHandler; ứng dụng có
+ * ISR EXTI riêng phải đặt STD_OFF để tránh trùng symbol.
+ ***********************************************************/
+#define DIO_EDGE_EVENT_SUPPORT  STD_ON
+
+/***********************************************************
+ * Số phần tử hàng đợi sự kiện cạnh (phải là lũy thừa của 2)
+ ***********************************************************/
+#define DIO_EDGE_QUEUE_SIZE     32u
+
+/***********************************************************
+ * Thanh ghi bộ đếm chu kỳ DWT của Cortex-M3 (địa chỉ kiến
+ * trúc, không phụ thuộc phiên bản CMSIS đi kèm SPL)
+ ***********************************************************/
+#define DIO_DEMCR               (*(volatile uint32_t *)0xE000EDFCu)
+#define DIO_DEMCR_TRCENA        ((uint32_t)0x01000000)
+#define DIO_DWT_CTRL            (*(volatile uint32_t *)0xE0001000u)
+#define DIO_DWT_CTRL_CYCCNTENA  ((uint32_t)0x00000001)
+#define DIO_DWT_CYCCNT          (*(volatile uint32_t *)0xE0001004u)
+
+/***********************************************************
+ * Nguồn timestamp cho sự kiện cạnh. Mặc định dùng bộ đếm
+ * chu kỳ DWT; Dio_Init gọi DIO_EDGE_TIMESTAMP_INIT() và
+ * phải chạy trước Port_Init nên bộ đếm luôn chạy trước khi
+ * ngắt EXTI đầu tiên được bật.
+ * Ứng dụng (hoặc test trên máy host) có thể định nghĩa lại
+ * hai macro này trước khi include, VD dùng một timer riêng.
+ ***********************************************************/
+#ifndef DIO_EDGE_TIMESTAMP_INIT
+#define DIO_EDGE_TIMESTAMP_INIT()   do { DIO_DEMCR |= DIO_DEMCR_TRCENA; \
+                                         DIO_DWT_CTRL |= DIO_DWT_CTRL_CYCCNTENA; } while (0)
+#endif
+
+#ifndef DIO_EDGE_TIMESTAMP
+#define DIO_EDGE_TIMESTAMP()        (DIO_DWT_CYCCNT)
+#endif
+
+#endif /* DIO_CFG_H */
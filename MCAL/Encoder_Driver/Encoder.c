@@ -0,0 +1,185 @@
+/***************************************************************************
+ * @file    Encoder.c
+ * @brief   Định nghĩa bộ giải mã quadrature dạng bảng
+ * @details Trạng thái một encoder là 2 bit (A << 1) | B. Chỉ số bảng là
+ *          (trạng thái cũ << 2) | trạng thái mới, giá trị bảng là bước dịch
+ *          +1 / -1 / 0 hoặc ENCODER_ILLEGAL khi A và B cùng đổi.
+ * @version 1.0
+ * @date    18-06-2025
+ ***************************************************************************/
+
+#include "Encoder.h"
+
+/* Giá trị bảng cho bước nhảy không hợp lệ */
+#define ENCODER_ILLEGAL     2
+
+/* Số port GPIO (A, B, C, D) */
+#define ENCODER_PORT_COUNT  4u
+
+/*
+ * Thứ tự Gray khi quay thuận: 00 -> 01 -> 11 -> 10 -> 00
+ *                 mới:  00               01               10               11
+ */
+static const sint8 EncoderTransitionTable[16] = {
+    /* cũ 00 */  0,               +1,              -1,              ENCODER_ILLEGAL,
+    /* cũ 01 */ -1,                0,              ENCODER_ILLEGAL, +1,
+    /* cũ 10 */ +1,               ENCODER_ILLEGAL,  0,              -1,
+    /* cũ 11 */ ENCODER_ILLEGAL,  -1,              +1,               0
+};
+
+/* Vị trí bit A/B trong ảnh port, tính sẵn lúc Encoder_Init */
+typedef struct
+{
+    uint8 PortA;
+    uint8 PinA;
+    uint8 PortB;
+    uint8 PinB;
+} Encoder_SampleMapType;
+
+static Encoder_SampleMapType EncoderMap[ENCODER_MAX_ENCODERS];
+static uint8 EncoderCount = 0;
+
+// Bit i = 1 nếu port i có chân encoder, chỉ những port này được đọc mỗi chu kỳ
+static uint8 EncoderPortMask = 0;
+
+// Trạng thái A/B của chu kỳ trước
+static uint8 EncoderState[ENCODER_MAX_ENCODERS];
+
+// Bộ đếm chỉ được ghi bởi Encoder_MainFunction
+static volatile Encoder_PositionType EncoderPosition[ENCODER_MAX_ENCODERS];
+static volatile uint32 EncoderIllegal[ENCODER_MAX_ENCODERS];
+
+/**
+ * @brief Đọc một lần mọi port có chân encoder
+ *
+ * @param[out] Snapshot Ảnh IDR của từng port
+ */
+static void Encoder_SamplePorts(Dio_PortLevelType Snapshot[ENCODER_PORT_COUNT])
+{
+    for (uint8 port = 0; port < ENCODER_PORT_COUNT; port++)
+    {
+        if (EncoderPortMask & (1u << port))
+        {
+            Snapshot[port] = Dio_ReadPort(port);
+        }
+    }
+}
+
+/**
+ * @brief Lấy trạng thái 2 bit (A << 1) | B của một encoder từ ảnh port
+ */
+static uint8 Encoder_GetState(const Dio_PortLevelType Snapshot[ENCODER_PORT_COUNT], const Encoder_SampleMapType *Map)
+{
+    uint8 a = (uint8)((Snapshot[Map->PortA] >> Map->PinA) & 0x01u);
+    uint8 b = (uint8)((Snapshot[Map->PortB] >> Map->PinB) & 0x01u);
+
+    return (uint8)((a << 1) | b);
+}
+
+/**
+ * @brief Khởi tạo bộ giải mã theo cấu hình
+ *
+ * @param ConfigPtr Con trỏ tới cấu hình encoder
+ */
+void Encoder_Init(const Encoder_ConfigType* ConfigPtr)
+{
+    Dio_PortLevelType snapshot[ENCODER_PORT_COUNT] = {0};
+
+    if (ConfigPtr == NULL_PTR) return;
+    if (ConfigPtr->EncoderCfg == NULL_PTR) return;
+    if (ConfigPtr->EncoderCount > ENCODER_MAX_ENCODERS) return;
+
+    EncoderCount = 0;
+    EncoderPortMask = 0;
+
+    for (uint8 i = 0; i < ConfigPtr->EncoderCount; i++)
+    {
+        Dio_ChannelType chA = ConfigPtr->EncoderCfg[i].ChannelA;
+        Dio_ChannelType chB = ConfigPtr->EncoderCfg[i].ChannelB;
+
+        // Kênh nằm ngoài 4 port thì bỏ toàn bộ cấu hình
+        if ((DIO_GET_PORT_INDEX(chA) >= ENCODER_PORT_COUNT) ||
+            (DIO_GET_PORT_INDEX(chB) >= ENCODER_PORT_COUNT)) return;
+
+        EncoderMap[i].PortA = DIO_GET_PORT_INDEX(chA);
+        EncoderMap[i].PinA  = DIO_GET_PIN_INDEX(chA);
+        EncoderMap[i].PortB = DIO_GET_PORT_INDEX(chB);
+        EncoderMap[i].PinB  = DIO_GET_PIN_INDEX(chB);
+
+        EncoderPortMask |= (uint8)(1u << EncoderMap[i].PortA);
+        EncoderPortMask |= (uint8)(1u << EncoderMap[i].PortB);
+    }
+
+    // Lấy trạng thái hiện tại làm gốc để chu kỳ đầu không bị đếm sai
+    Encoder_SamplePorts(snapshot);
+    for (uint8 i = 0; i < ConfigPtr->EncoderCount; i++)
+    {
+        EncoderState[i]    = Encoder_GetState(snapshot, &EncoderMap[i]);
+        EncoderPosition[i] = 0;
+        EncoderIllegal[i]  = 0;
+    }
+
+    EncoderCount = ConfigPtr->EncoderCount;
+}
+
+/**
+ * @brief Lấy mẫu và giải mã toàn bộ encoder
+ *
+ * @details Chi phí: một lần đọc IDR cho mỗi port liên quan, một lần tra bảng
+ *          cho mỗi encoder.
+ */
+void Encoder_MainFunction(void)
+{
+    Dio_PortLevelType snapshot[ENCODER_PORT_COUNT];
+
+    if (EncoderCount == 0u) return;
+
+    Encoder_SamplePorts(snapshot);
+
+    for (uint8 i = 0; i < EncoderCount; i++)
+    {
+        uint8 state = Encoder_GetState(snapshot, &EncoderMap[i]);
+        sint8 step  = EncoderTransitionTable[(EncoderState[i] << 2) | state];
+
+        EncoderState[i] = state;
+
+        if (step == ENCODER_ILLEGAL)
+            EncoderIllegal[i]++;
+        else
+            EncoderPosition[i] += step;
+    }
+}
+
+/**
+ * @brief Đọc vị trí hiện tại của một encoder
+ */
+Encoder_PositionType Encoder_GetPosition(Encoder_IdType EncoderId)
+{
+    if (EncoderId >= EncoderCount) return 0;
+
+    return EncoderPosition[EncoderId];
+}
+
+/**
+ * @brief Đọc số bước nhảy không hợp lệ của một encoder
+ */
+uint32 Encoder_GetIllegalCount(Encoder_IdType EncoderId)
+{
+    if (EncoderId >= EncoderCount) return 0;
+
+    return EncoderIllegal[EncoderId];
+}
+
+/**
+ * @brief Trả về thông tin phiên bản của module.
+ */
+void Encoder_GetVersionInfo(Std_VersionInfoType* VersionInfo)
+{
+    if (VersionInfo == NULL_PTR) return;
+
+    VersionInfo->vendorID = ENCODER_VENDOR_ID;
+    VersionInfo->moduleID = ENCODER_MODULE_ID;
+    VersionInfo->sw_major_version = ENCODER_SW_MAJOR_VERSION;
+    VersionInfo->sw_minor_version = ENCODER_SW_MINOR_VERSION;
+    VersionInfo->sw_patch_version = ENCODER_SW_PATCH_VERSION;
+}
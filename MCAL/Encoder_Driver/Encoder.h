@@ -0,0 +1,94 @@
+/***************************************************************************
+ * @file    Encoder.h
+ * @brief   Giải mã nhiều encoder quadrature trên các cặp kênh DIO A/B
+ * @details Mỗi chu kỳ Encoder_MainFunction đọc mỗi port liên quan đúng một
+ *          lần bằng Dio_ReadPort, sau đó giải mã mọi encoder bằng một lần tra
+ *          bảng chuyển trạng thái 16 phần tử. Bước nhảy không hợp lệ (A và B
+ *          cùng đổi) được đếm riêng để chẩn đoán.
+ * @version 1.0
+ * @date    18-06-2025
+ ***************************************************************************/
+
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include "Std_Type.h"
+#include "Dio.h"
+
+/// @brief Chỉ số encoder trong mảng cấu hình
+typedef uint8 Encoder_IdType;
+
+/// @brief Vị trí encoder (đơn vị: bước quadrature, 4 bước mỗi chu kỳ A/B)
+typedef sint32 Encoder_PositionType;
+
+/// @brief Cấu hình một encoder
+typedef struct
+{
+    Dio_ChannelType ChannelA;   ///< Kênh DIO của pha A
+    Dio_ChannelType ChannelB;   ///< Kênh DIO của pha B
+} Encoder_ChannelConfigType;
+
+/// @brief Cấu hình tổng cho nhiều encoder
+typedef struct
+{
+    const Encoder_ChannelConfigType *EncoderCfg;    ///< Mảng cấu hình từng encoder
+    uint8 EncoderCount;                             ///< Số encoder được cấu hình
+} Encoder_ConfigType;
+
+/// @name Định nghĩa là Driver version
+#define ENCODER_VENDOR_ID    1001u
+#define ENCODER_MODULE_ID    250u
+#define ENCODER_SW_MAJOR_VERSION 1u
+#define ENCODER_SW_MINOR_VERSION 0u
+#define ENCODER_SW_PATCH_VERSION 0u
+
+/// @brief Số encoder tối đa
+#define ENCODER_MAX_ENCODERS    8u
+
+//==============================================================================
+//                              API FUNCTIONS
+//==============================================================================
+
+/**
+ * @brief Khởi tạo bộ giải mã, lấy trạng thái A/B hiện tại làm trạng thái đầu
+ * @param ConfigPtr Con trỏ tới cấu hình encoder
+ *
+ * @note Các chân A/B phải đã được Port_Init cấu hình là input.
+ */
+void Encoder_Init(const Encoder_ConfigType* ConfigPtr);
+
+/**
+ * @brief Lấy mẫu và giải mã toàn bộ encoder, gọi định kỳ từ một task/timer
+ *
+ * @details Chu kỳ gọi phải ngắn hơn khoảng thời gian giữa hai bước quadrature
+ *          nhanh nhất, nếu không bước nhảy sẽ bị đếm là không hợp lệ.
+ */
+void Encoder_MainFunction(void);
+
+/**
+ * @brief Đọc vị trí hiện tại của một encoder
+ *
+ * @param[in] EncoderId Chỉ số encoder
+ *
+ * @return Vị trí (bước quadrature), 0 nếu EncoderId không hợp lệ
+ *
+ * @note An toàn khi gọi từ task khác: giá trị 32 bit do duy nhất
+ *       Encoder_MainFunction ghi, đọc 32 bit trên Cortex-M3 là nguyên tử.
+ */
+Encoder_PositionType Encoder_GetPosition(Encoder_IdType EncoderId);
+
+/**
+ * @brief Đọc số bước nhảy không hợp lệ (A và B cùng đổi trong một chu kỳ)
+ *
+ * @param[in] EncoderId Chỉ số encoder
+ */
+uint32 Encoder_GetIllegalCount(Encoder_IdType EncoderId);
+
+/**
+ * @brief Lấy thông tin version của module Encoder
+ *
+ * @param[in,out] VersionInfo Con trỏ đến biến chứa thông tin version.
+ */
+void Encoder_GetVersionInfo(Std_VersionInfoType* VersionInfo);
+
+#endif /* ENCODER_H */
@@ -0,0 +1,17 @@
+#include "Encoder_Cfg.h"
+
+const Encoder_ChannelConfigType EncoderCfg_Channels[EncoderCount_Cfg] = {
+    {
+        .ChannelA = 22, // port B chân 6
+        .ChannelB = 23  // port B chân 7
+    },
+    {
+        .ChannelA = 6,  // port A chân 6
+        .ChannelB = 7   // port A chân 7
+    },
+};
+
+const Encoder_ConfigType Encoder_Config = {
+    .EncoderCfg = EncoderCfg_Channels,
+    .EncoderCount = EncoderCount_Cfg
+};
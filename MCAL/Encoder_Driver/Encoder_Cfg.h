@@ -0,0 +1,25 @@
+/***********************************************************
+ *  @file    Encoder_Cfg.h
+ *  @brief   Encoder Configuration Header File
+ *  @details File này chứa cấu hình các cặp kênh DIO A/B
+ *           của encoder quadrature, dùng trên STM32F103
+ *           với thư viện SPL.
+ ***********************************************************/
+
+#ifndef ENCODER_CFG_H
+#define ENCODER_CFG_H
+
+#include "Encoder.h"  /* Bao gồm các kiểu dữ liệu của Encoder */
+
+/***********************************************************
+ * Số encoder được cấu hình (tùy chỉnh theo dự án)
+ ***********************************************************/
+#define EncoderCount_Cfg    2
+
+/***********************************************************
+ * Cấu hình encoder (định nghĩa cụ thể ở Encoder_Cfg.c)
+ ***********************************************************/
+extern const Encoder_ChannelConfigType EncoderCfg_Channels[EncoderCount_Cfg];
+extern const Encoder_ConfigType Encoder_Config;
+
+#endif /* ENCODER_CFG_H */
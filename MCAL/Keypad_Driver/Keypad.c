@@ -0,0 +1,217 @@
+/***************************************************************************
+ * @file    Keypad.c
+ * @brief   Định nghĩa bộ quét ma trận phím dựa trên nhóm kênh DIO
+ * @details Mỗi lần gọi chỉ tốn một lần đọc IDR (cột) và một lần ghi BSRR
+ *          (hàng), nên thời gian quét tỉ lệ với số hàng chứ không phải
+ *          hàng x cột. Chống dội dùng bộ đếm dọc 2 bit: mọi cột của một hàng
+ *          được xử lý song song bằng vài phép toán bit.
+ * @version 1.0
+ * @date    18-06-2025
+ ***************************************************************************/
+
+#include "Keypad.h"
+#include "stm32f10x.h"
+
+// Cấu hình đang dùng, NULL_PTR nếu chưa khởi tạo
+static const Keypad_ConfigType *KeypadConfig = NULL_PTR;
+
+static uint8 KeypadRowCount = 0;
+static Dio_PortLevelType KeypadRowLevelMask = 0;    // Bit của các hàng sau khi dịch offset
+static Keypad_RowBitmapType KeypadColumnMask = 0;   // Bit của các cột sau khi dịch offset
+
+// Hàng đang được kéo xuống, cột của nó sẽ được đọc ở lần gọi kế tiếp
+static uint8 KeypadCurrentRow = 0;
+
+// Mẫu thô của khung quét hiện tại
+static Keypad_RowBitmapType KeypadRaw[KEYPAD_MAX_ROWS];
+
+// Bộ đếm dọc 2 bit (Cnt1:Cnt0) cho từng phím và bitmap đã chống dội
+static Keypad_RowBitmapType KeypadCnt0[KEYPAD_MAX_ROWS];
+static Keypad_RowBitmapType KeypadCnt1[KEYPAD_MAX_ROWS];
+static volatile Keypad_RowBitmapType KeypadState[KEYPAD_MAX_ROWS];
+
+static volatile uint8 KeypadGhosting = 0;
+
+/**
+ * @brief Đếm số bit 1 trong mặt nạ
+ */
+static uint8 Keypad_CountBits(Dio_PortLevelType Mask)
+{
+    uint8 count = 0;
+
+    while (Mask != 0u)
+    {
+        Mask &= (Dio_PortLevelType)(Mask - 1u);
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Kéo một hàng xuống mức thấp, thả nổi các hàng còn lại (một lần ghi BSRR)
+ *
+ * @details Hàng là open-drain nên bit 1 không lái mức cao, cột chỉ được kéo lên
+ *          bởi điện trở pull-up.
+ */
+static void Keypad_DriveRow(uint8 Row)
+{
+    Dio_WriteChannelGroup(KeypadConfig->RowGroup,
+                          (Dio_PortLevelType)(KeypadRowLevelMask & ~(1u << Row)));
+}
+
+/**
+ * @brief Kiểm tra ghosting của khung quét
+ *
+ * @details Ma trận không có diode sẽ sinh phím ảo khi ba góc của một hình chữ
+ *          nhật được nhấn; khi đó luôn có hai hàng cùng có ít nhất hai cột chung.
+ */
+static uint8 Keypad_DetectGhosting(void)
+{
+    for (uint8 i = 0; i < KeypadRowCount; i++)
+    {
+        // Hàng có ít hơn 2 phím nhấn thì không thể tạo hình chữ nhật
+        if ((KeypadRaw[i] & (KeypadRaw[i] - 1u)) == 0u) continue;
+
+        for (uint8 j = i + 1u; j < KeypadRowCount; j++)
+        {
+            Keypad_RowBitmapType common = KeypadRaw[i] & KeypadRaw[j];
+            if ((common & (common - 1u)) != 0u) return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Xử lý một khung quét: ghosting, chống dội và báo sự kiện
+ */
+static void Keypad_ProcessFrame(void)
+{
+    KeypadGhosting = Keypad_DetectGhosting();
+
+    // Khung bị ghosting không đáng tin, giữ nguyên trạng thái cũ
+    if (KeypadGhosting) return;
+
+    for (uint8 row = 0; row < KeypadRowCount; row++)
+    {
+        Keypad_RowBitmapType state = KeypadState[row];
+        Keypad_RowBitmapType delta = KeypadRaw[row] ^ state;
+
+        // Bộ đếm tăng khi mẫu khác trạng thái, về 0 khi giống; tràn sau 4 khung thì đổi trạng thái
+        KeypadCnt1[row] = (KeypadCnt1[row] ^ KeypadCnt0[row]) & delta;
+        KeypadCnt0[row] = (Keypad_RowBitmapType)(~KeypadCnt0[row]) & delta;
+
+        Keypad_RowBitmapType toggle = delta & (Keypad_RowBitmapType)~(KeypadCnt0[row] | KeypadCnt1[row]);
+        if (toggle == 0u) continue;
+
+        state ^= toggle;
+        KeypadState[row] = state;
+
+        if (KeypadConfig->Notification == NULL_PTR) continue;
+
+        while (toggle != 0u)
+        {
+            uint8 column = (uint8)__CLZ(__RBIT(toggle));  // Bit thấp nhất vừa đổi
+            toggle &= (Keypad_RowBitmapType)(toggle - 1u);
+
+            KeypadConfig->Notification(row, column,
+                                       (state & (1u << column)) ? KEYPAD_KEY_PRESSED : KEYPAD_KEY_RELEASED);
+        }
+    }
+}
+
+/**
+ * @brief Khởi tạo bộ quét ma trận phím
+ *
+ * @param ConfigPtr Con trỏ tới cấu hình ma trận phím
+ */
+void Keypad_Init(const Keypad_ConfigType* ConfigPtr)
+{
+    if (ConfigPtr == NULL_PTR) return;
+    if ((ConfigPtr->RowGroup == NULL_PTR) || (ConfigPtr->ColumnGroup == NULL_PTR)) return;
+
+    Dio_PortLevelType rows = ConfigPtr->RowGroup->mask >> ConfigPtr->RowGroup->offset;
+    Dio_PortLevelType cols = ConfigPtr->ColumnGroup->mask >> ConfigPtr->ColumnGroup->offset;
+
+    if ((rows == 0u) || (cols == 0u)) return;
+
+    KeypadConfig       = NULL_PTR;
+    KeypadRowCount     = Keypad_CountBits(rows);
+    KeypadRowLevelMask = rows;
+    KeypadColumnMask   = cols;
+    KeypadCurrentRow   = 0;
+    KeypadGhosting     = 0;
+
+    for (uint8 row = 0; row < KEYPAD_MAX_ROWS; row++)
+    {
+        KeypadRaw[row]   = 0;
+        KeypadCnt0[row]  = 0;
+        KeypadCnt1[row]  = 0;
+        KeypadState[row] = 0;
+    }
+
+    KeypadConfig = ConfigPtr;
+    Keypad_DriveRow(KeypadCurrentRow);
+}
+
+/**
+ * @brief Đọc cột của hàng hiện tại rồi chuyển sang hàng kế tiếp
+ */
+void Keypad_MainFunction(void)
+{
+    if (KeypadConfig == NULL_PTR) return;
+
+    // Cột kéo lên: phím nhấn nối cột với hàng đang ở mức thấp
+    Dio_PortLevelType cols = Dio_ReadChannelGroup(KeypadConfig->ColumnGroup);
+    KeypadRaw[KeypadCurrentRow] = (Keypad_RowBitmapType)(~cols & KeypadColumnMask);
+
+    KeypadCurrentRow++;
+    if (KeypadCurrentRow >= KeypadRowCount) KeypadCurrentRow = 0;
+
+    // Kéo hàng kế tiếp ngay để có cả chu kỳ gọi cho tín hiệu ổn định
+    Keypad_DriveRow(KeypadCurrentRow);
+
+    if (KeypadCurrentRow == 0u)
+    {
+        Keypad_ProcessFrame();
+    }
+}
+
+/**
+ * @brief Đọc bitmap phím đã chống dội của toàn bộ ma trận
+ */
+Std_ReturnType Keypad_GetKeyMap(Keypad_RowBitmapType* KeyMapPtr)
+{
+    if (KeyMapPtr == NULL_PTR) return E_NOT_OK;
+    if (KeypadConfig == NULL_PTR) return E_NOT_OK;
+
+    for (uint8 row = 0; row < KeypadRowCount; row++)
+    {
+        KeyMapPtr[row] = KeypadState[row];
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Kiểm tra khung quét gần nhất có bị ghosting hay không
+ */
+uint8 Keypad_IsGhosting(void)
+{
+    return KeypadGhosting;
+}
+
+/**
+ * @brief Trả về thông tin phiên bản của module.
+ */
+void Keypad_GetVersionInfo(Std_VersionInfoType* VersionInfo)
+{
+    if (VersionInfo == NULL_PTR) return;
+
+    VersionInfo->vendorID = KEYPAD_VENDOR_ID;
+    VersionInfo->moduleID = KEYPAD_MODULE_ID;
+    VersionInfo->sw_major_version = KEYPAD_SW_MAJOR_VERSION;
+    VersionInfo->sw_minor_version = KEYPAD_SW_MINOR_VERSION;
+    VersionInfo->sw_patch_version = KEYPAD_SW_PATCH_VERSION;
+}
@@ -0,0 +1,99 @@
+/***************************************************************************
+ * @file    Keypad.h
+ * @brief   Quét ma trận phím / ma trận công tắc trên hai nhóm kênh DIO
+ * @details Hàng (output open-drain) và cột (input kéo lên) là hai Dio_ChannelGroupType.
+ *          Mỗi lần gọi Keypad_MainFunction đọc cột của hàng đang được kéo
+ *          xuống bằng một lần đọc IDR, rồi kéo hàng kế tiếp bằng một lần ghi
+ *          BSRR. Hàng được giữ trong cả chu kỳ gọi nên có thời gian ổn định
+ *          mà không cần chờ. Hàng bắt buộc là open-drain: hàng không quét
+ *          được "ghi 1" tức là thả nổi, nên nhấn hai phím cùng cột không
+ *          làm ngắn mạch hai output đẩy-kéo. Hết một khung quét, driver kiểm tra ghosting,
+ *          chống dội bằng bộ đếm dọc và báo sự kiện phím thay đổi.
+ * @version 1.0
+ * @date    18-06-2025
+ ***************************************************************************/
+
+#ifndef KEYPAD_H
+#define KEYPAD_H
+
+#include "Std_Type.h"
+#include "Dio.h"
+
+/// @brief Bitmap các cột của một hàng (bit i = cột i)
+typedef uint16 Keypad_RowBitmapType;
+
+/// @brief Trạng thái một phím sau chống dội
+typedef enum {
+    KEYPAD_KEY_RELEASED = 0x00,     ///< Phím nhả
+    KEYPAD_KEY_PRESSED  = 0x01      ///< Phím nhấn
+} Keypad_KeyStateType;
+
+/// @brief Hàm notification khi một phím đổi trạng thái (gọi từ Keypad_MainFunction)
+typedef void (*Keypad_NotificationType)(uint8 Row, uint8 Column, Keypad_KeyStateType State);
+
+/// @brief Cấu hình ma trận phím
+typedef struct
+{
+    const Dio_ChannelGroupType *RowGroup;       ///< Nhóm kênh hàng (output open-drain, tích cực mức thấp)
+    const Dio_ChannelGroupType *ColumnGroup;    ///< Nhóm kênh cột (input kéo lên)
+    Keypad_NotificationType Notification;       ///< Callback sự kiện phím, NULL_PTR nếu không dùng
+} Keypad_ConfigType;
+
+/// @name Định nghĩa là Driver version
+#define KEYPAD_VENDOR_ID    1001u
+#define KEYPAD_MODULE_ID    251u
+#define KEYPAD_SW_MAJOR_VERSION 1u
+#define KEYPAD_SW_MINOR_VERSION 0u
+#define KEYPAD_SW_PATCH_VERSION 0u
+
+/// @brief Số hàng tối đa (một port 16 chân)
+#define KEYPAD_MAX_ROWS     16u
+
+//==============================================================================
+//                              API FUNCTIONS
+//==============================================================================
+
+/**
+ * @brief Khởi tạo bộ quét và kéo hàng đầu tiên xuống
+ * @param ConfigPtr Con trỏ tới cấu hình ma trận phím
+ *
+ * @note Chân hàng/cột phải đã được Port_Init cấu hình: hàng là output open-drain
+ *       (Pull = PULL_DOWN -> GPIO_Mode_Out_OD, Level = PORT_PIN_LEVEL_HIGH),
+ *       cột là input PULL_UP. Hàng đẩy-kéo sẽ ngắn mạch khi nhấn hai phím cùng cột.
+ */
+void Keypad_Init(const Keypad_ConfigType* ConfigPtr);
+
+/**
+ * @brief Quét một hàng, gọi định kỳ từ một task/timer
+ *
+ * @details Một khung quét đầy đủ mất số lần gọi bằng số hàng. Phím được xác
+ *          nhận sau 4 khung liên tiếp có cùng trạng thái.
+ */
+void Keypad_MainFunction(void);
+
+/**
+ * @brief Đọc bitmap phím đã chống dội của toàn bộ ma trận
+ *
+ * @param[out] KeyMapPtr Mảng nhận bitmap, tối thiểu số hàng phần tử
+ *
+ * @return E_OK nếu đã khởi tạo, ngược lại E_NOT_OK
+ */
+Std_ReturnType Keypad_GetKeyMap(Keypad_RowBitmapType* KeyMapPtr);
+
+/**
+ * @brief Kiểm tra khung quét gần nhất có bị ghosting hay không
+ *
+ * @details Khi có ghosting, bitmap chống dội được giữ nguyên cho tới khi hết.
+ *
+ * @return 1 nếu hai hàng cùng có ít nhất hai cột chung đang nhấn, ngược lại 0
+ */
+uint8 Keypad_IsGhosting(void);
+
+/**
+ * @brief Lấy thông tin version của module Keypad
+ *
+ * @param[in,out] VersionInfo Con trỏ đến biến chứa thông tin version.
+ */
+void Keypad_GetVersionInfo(Std_VersionInfoType* VersionInfo);
+
+#endif /* KEYPAD_H */
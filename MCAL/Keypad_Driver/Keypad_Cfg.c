@@ -0,0 +1,21 @@
+#include "Keypad_Cfg.h"
+
+// Hàng: PB12..PB15 (output open-drain)
+const Dio_ChannelGroupType KeypadCfg_Rows = {
+    .mask = 0xF000,
+    .offset = 12,
+    .port = GPIO_PORT_B
+};
+
+// Cột: PA8..PA11 (input PULL_UP)
+const Dio_ChannelGroupType KeypadCfg_Columns = {
+    .mask = 0x0F00,
+    .offset = 8,
+    .port = GPIO_PORT_A
+};
+
+const Keypad_ConfigType Keypad_Config = {
+    .RowGroup = &KeypadCfg_Rows,
+    .ColumnGroup = &KeypadCfg_Columns,
+    .Notification = NULL_PTR
+};
@@ -0,0 +1,22 @@
+/***********************************************************
+ *  @file    Keypad_Cfg.h
+ *  @brief   Keypad Configuration Header File
+ *  @details File này chứa cấu hình nhóm kênh hàng/cột của
+ *           ma trận phím, dùng trên STM32F103 với thư
+ *           viện SPL.
+ ***********************************************************/
+
+#ifndef KEYPAD_CFG_H
+#define KEYPAD_CFG_H
+
+#include "Keypad.h"  /* Bao gồm các kiểu dữ liệu của Keypad */
+
+/***********************************************************
+ * Nhóm kênh hàng/cột và cấu hình ma trận phím
+ * (định nghĩa cụ thể ở Keypad_Cfg.c)
+ ***********************************************************/
+extern const Dio_ChannelGroupType KeypadCfg_Rows;
+extern const Dio_ChannelGroupType KeypadCfg_Columns;
+extern const Keypad_ConfigType Keypad_Config;
+
+#endif /* KEYPAD_CFG_H */
@@ -5,6 +5,57 @@
 // Biến trạng thái xác định xem Port đã được khởi tạo hay chưa
 static uint8 PortInitState = 0;
 
+/**
+ * @brief Định tuyến AFIO và cấu hình line EXTI cho chân input có sinh sự kiện cạnh
+ *
+ * @details Line EXTI n được nối tới chân số n của Port đã chọn qua AFIO_EXTICR.
+ *          Nếu chân không còn là DIO input (VD sau Port_SetPinDirection) thì line
+ *          bị tắt để ISR không đọc nhầm chân output.
+ *
+ * @param Portconf Con trỏ tới cấu hình một chân GPIO
+ */
+static void Port_Deploy_exti(const Port_PinConfigType *Portconf)
+{
+    EXTI_InitTypeDef EXTI_InitStruct;
+    uint8 pin = (uint8)(Portconf->PinID % 16);
+
+    EXTI_InitStruct.EXTI_Line = PORT_GET_PIN_NUM(pin);
+    EXTI_InitStruct.EXTI_Mode = EXTI_Mode_Interrupt;
+    EXTI_InitStruct.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
+
+    if ((Portconf->PinMode != PORT_PIN_MODE_DIO) || (Portconf->Direction != PORT_PIN_IN))
+    {
+        EXTI_InitStruct.EXTI_LineCmd = DISABLE;
+        EXTI_Init(&EXTI_InitStruct);
+        return;
+    }
+
+    switch (Portconf->Edge)
+    {
+        case PORT_PIN_EDGE_RISING:
+            EXTI_InitStruct.EXTI_Trigger = EXTI_Trigger_Rising;
+            break;
+        case PORT_PIN_EDGE_FALLING:
+            EXTI_InitStruct.EXTI_Trigger = EXTI_Trigger_Falling;
+            break;
+        default:
+            EXTI_InitStruct.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
+            break;
+    }
+
+    // Chọn Port nối vào line EXTI (GPIO_PortSourceGPIOx trùng với PortID)
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
+    GPIO_EXTILineConfig(Portconf->PortID, pin);
+
+    EXTI_ClearITPendingBit(EXTI_InitStruct.EXTI_Line);
+    EXTI_InitStruct.EXTI_LineCmd = ENABLE;
+    EXTI_Init(&EXTI_InitStruct);
+
+    // Mọi IRQ EXTI cùng mức ưu tiên để ISR không chen ngang nhau
+    NVIC_SetPriority(PORT_GET_EXTI_IRQ(pin), PORT_EXTI_IRQ_PRIORITY);
+    NVIC_EnableIRQ(PORT_GET_EXTI_IRQ(pin));
+}
+
 /**
  * @brief Hàm triển khai cấu hình cho từng chân GPIO theo cấu hình đã định nghĩa
  *
@@ -69,7 +120,8 @@ void Port_Deploy_pin(const Port_PinConfigType *Portconf)
     }
     else if (Portconf->PinMode == PORT_PIN_MODE_ADC)
     {
-        // do not thing
+        // Analog: ngắt Schmitt trigger, không pull, ADC đọc trực tiếp
+        GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AIN;
     }
     else if (Portconf->PinMode == PORT_PIN_MODE_PWM)
     {
@@ -80,13 +132,19 @@ void Port_Deploy_pin(const Port_PinConfigType *Portconf)
     GPIO_Init(PORT_GET_ID(Portconf->PortID), &GPIO_InitStruct);
 
     // Nếu là chân output, cấu hình trạng thái mặc định (level)
-    if (Portconf->Direction == PORT_PIN_OUT)
+    if ((Portconf->PinMode != PORT_PIN_MODE_ADC) && (Portconf->Direction == PORT_PIN_OUT))
     {
         if (Portconf->Level == PORT_PIN_LEVEL_HIGH)
             GPIO_WriteBit(PORT_GET_ID(Portconf->PortID), GPIO_InitStruct.GPIO_Pin, PORT_PIN_LEVEL_HIGH);
         else
             GPIO_WriteBit(PORT_GET_ID(Portconf->PortID), GPIO_InitStruct.GPIO_Pin, PORT_PIN_LEVEL_LOW);
     }
+
+    // Nếu chân có cấu hình sinh sự kiện cạnh, định tuyến EXTI
+    if (Portconf->Edge != PORT_PIN_EDGE_NONE)
+    {
+        Port_Deploy_exti(Portconf);
+    }
 }
 
 /**
@@ -141,7 +199,7 @@ void Port_RefreshPortDirection(void)
     if (!PortInitState) return;
     for (uint8_t i = 0; i < Pincount; i++)
     {
-        if (PortCfg_Pins[Pincount].DirectionChangeable == 0)
+        if (PortCfg_Pins[i].DirectionChangeable == 0)
                 Port_Deploy_pin(&PortCfg_Pins[i]);
     }
 }
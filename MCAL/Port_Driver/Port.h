@@ -14,6 +14,7 @@
 #include "stm32f10x_gpio.h"
 #include "stm32f10x.h"
 #include "stm32f10x_rcc.h"
+#include "stm32f10x_exti.h"
 
 /// @name GPIO Pull configuration
 /// @{
@@ -43,6 +44,18 @@ typedef enum {
     PORT_PIN_OUT = 0x00     ///< Hướng Output
 } Port_PinDirectionType;
 
+/**
+ * @brief Cạnh tín hiệu sinh ngắt EXTI cho chân input
+ * @note  Với PORT_PIN_EDGE_BOTH, hai cạnh của một xung ngắn hơn độ trễ ngắt
+ *        gộp thành một sự kiện DIO_EDGE_BOTH (không rõ hướng cạnh).
+ */
+typedef enum {
+    PORT_PIN_EDGE_NONE    = 0x00,   ///< Không dùng ngắt
+    PORT_PIN_EDGE_RISING  = 0x01,   ///< Ngắt cạnh lên
+    PORT_PIN_EDGE_FALLING = 0x02,   ///< Ngắt cạnh xuống
+    PORT_PIN_EDGE_BOTH    = 0x03    ///< Ngắt cả hai cạnh
+} Port_PinEdgeType;
+
 /// @brief Cấu hình cho một chân GPIO
 typedef struct
 {
@@ -55,6 +68,7 @@ typedef struct
     uint8 Level;                            ///< Mức logic mặc định nếu là Output
     uint8 DirectionChangeable;             ///< Cho phép thay đổi hướng trong runtime
     uint8 ModeChangeable;                  ///< Cho phép thay đổi chế độ trong runtime
+    Port_PinEdgeType Edge;                 ///< Cạnh sinh sự kiện EXTI (chỉ với DIO input)
 } Port_PinConfigType;
 
 /// @brief Cấu trúc cấu hình tổng cho nhiều chân GPIO
@@ -90,6 +104,11 @@ typedef struct
 /// @brief Macro lấy giá trị bit tương ứng với chân GPIO (ví dụ 1 << 8 với chân số 8)
 #define PORT_GET_PIN_NUM(Pin)      (1 << ((Pin) % 16))
 
+/// @brief Macro lấy IRQ EXTI tương ứng với chân (EXTI0..4 riêng, 5..9 và 10..15 dùng chung)
+#define PORT_GET_EXTI_IRQ(Pin)     ((((Pin) % 16) < 5)  ? (IRQn_Type)(EXTI0_IRQn + ((Pin) % 16)) : \
+                                    (((Pin) % 16) < 10) ? EXTI9_5_IRQn : \
+                                    EXTI15_10_IRQn)
+
 //==============================================================================
 //                              API FUNCTIONS
 //==============================================================================
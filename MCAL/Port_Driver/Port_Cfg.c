@@ -21,7 +21,155 @@ const Port_PinConfigType PortCfg_Pins[Pincount] = {
         .Pull = PULL_UP,
         .Level = PORT_PIN_LEVEL_LOW,
         .DirectionChangeable = 0,
+        .ModeChangeable = 0,
+        .Edge = PORT_PIN_EDGE_FALLING // nút nhấn kéo lên, nhấn = cạnh xuống
+    },
+    {
+        .PortID = 0, // port A
+        .PinID = 0,// chân 0 -> ADC1 kênh 0
+        .PinMode = PORT_PIN_MODE_ADC,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_DOWN,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 1, // port B
+        .PinID = 22,// chân 6 -> encoder 0 pha A
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_UP,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
         .ModeChangeable = 0
     },
-    // ...
-};
\ No newline at end of file
+    {
+        .PortID = 1, // port B
+        .PinID = 23,// chân 7 -> encoder 0 pha B
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_UP,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 0, // port A
+        .PinID = 6,// chân 6 -> encoder 1 pha A
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_UP,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 0, // port A
+        .PinID = 7,// chân 7 -> encoder 1 pha B
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_UP,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 1, // port B
+        .PinID = 28,// chân 12 -> hàng 0 keypad (open-drain, thả nổi)
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_OUT,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_DOWN,
+        .Level = PORT_PIN_LEVEL_HIGH,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 1, // port B
+        .PinID = 29,// chân 13 -> hàng 1 keypad (open-drain, thả nổi)
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_OUT,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_DOWN,
+        .Level = PORT_PIN_LEVEL_HIGH,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 1, // port B
+        .PinID = 30,// chân 14 -> hàng 2 keypad (open-drain, thả nổi)
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_OUT,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_DOWN,
+        .Level = PORT_PIN_LEVEL_HIGH,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 1, // port B
+        .PinID = 31,// chân 15 -> hàng 3 keypad (open-drain, thả nổi)
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_OUT,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_DOWN,
+        .Level = PORT_PIN_LEVEL_HIGH,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 0, // port A
+        .PinID = 8,// chân 8 -> cột 0 keypad
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_UP,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 0, // port A
+        .PinID = 9,// chân 9 -> cột 1 keypad
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_UP,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 0, // port A
+        .PinID = 10,// chân 10 -> cột 2 keypad
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_UP,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+    {
+        .PortID = 0, // port A
+        .PinID = 11,// chân 11 -> cột 3 keypad
+        .PinMode = PORT_PIN_MODE_DIO,
+        .Direction = PORT_PIN_IN,
+        .Speed = GPIO_Speed_2MHz,
+        .Pull = PULL_UP,
+        .Level = PORT_PIN_LEVEL_LOW,
+        .DirectionChangeable = 0,
+        .ModeChangeable = 0
+    },
+};
+
+const Port_ConfigType Port_Config = {
+    .PinCfgType = PortCfg_Pins,
+    .PortCfg_PinsCount = Pincount
+};
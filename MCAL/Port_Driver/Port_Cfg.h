@@ -13,8 +13,17 @@
 
 /***********************************************************
  * Số lượng chân Port được cấu hình (tùy chỉnh theo dự án)
+ * Phải bằng đúng số phần tử khai báo trong PortCfg_Pins:
+ * phần tử thừa bị điền 0 sẽ thành PA0 output open-drain.
  ***********************************************************/
-#define Pincount     64     // Tổng số chân của STM32 có trong 4 port
+#define Pincount     15     // Số chân thực sự được cấu hình
+
+/***********************************************************
+ * Mức ưu tiên NVIC chung cho mọi ngắt EXTI. Các ISR EXTI
+ * không được chen ngang nhau vì hàng đợi sự kiện của Dio
+ * chỉ cho phép một bên ghi tại một thời điểm.
+ ***********************************************************/
+#define PORT_EXTI_IRQ_PRIORITY     5u
 
 /***********************************************************
  * Mảng cấu hình chi tiết cho từng chân GPIO
@@ -22,4 +31,9 @@
  ***********************************************************/
 extern const Port_PinConfigType PortCfg_Pins[Pincount];
 
+/***********************************************************
+ * Cấu hình tổng truyền vào Port_Init
+ ***********************************************************/
+extern const Port_ConfigType Port_Config;
+
 #endif /* PORT_CFG_H */
@@ -0,0 +1,12 @@
+/***************************************************************************
+ * @file    Det.h
+ * @brief   Bản Det tối thiểu để build driver trên máy host (test)
+ ***************************************************************************/
+#ifndef DET_H
+#define DET_H
+
+#include "Std_Type.h"
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
+
+#endif /* DET_H */
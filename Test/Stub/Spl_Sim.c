@@ -0,0 +1,308 @@
+/***************************************************************************
+ * @file    Spl_Sim.c
+ * @brief   Bộ giả lập thanh ghi và API SPL cho test driver trên máy host
+ ***************************************************************************/
+
+#include <string.h>
+#include "Spl_Sim.h"
+#include "stm32f10x_gpio.h"
+#include "stm32f10x_rcc.h"
+#include "stm32f10x_exti.h"
+#include "stm32f10x_adc.h"
+#include "stm32f10x_dma.h"
+
+/* Cờ trong DMA1->ISR cho Channel1 */
+#define SIM_DMA_GIF1    ((uint32_t)0x00000001)
+#define SIM_DMA_TCIF1   ((uint32_t)0x00000002)
+#define SIM_DMA_HTIF1   ((uint32_t)0x00000004)
+#define SIM_DMA_CH1     ((uint32_t)0x0000000F)
+
+#define SIM_IRQ_COUNT   64u
+
+GPIO_TypeDef Sim_GPIOA, Sim_GPIOB, Sim_GPIOC, Sim_GPIOD;
+AFIO_TypeDef Sim_AFIO;
+EXTI_TypeDef Sim_EXTI;
+ADC_TypeDef Sim_ADC1;
+DMA_Channel_TypeDef Sim_DMA1_Channel1;
+volatile uint32_t Sim_CycleCounter;
+volatile uint8_t Sim_CycleCounterEnabled;
+
+static uint32_t SimDma1Isr = 0;
+static uint32_t SimDmaReload = 0;
+static uint8_t SimAdcRunning = 0;
+static uint8_t SimAdcSequence[16];
+static uint8_t SimAdcChannelCount = 0;
+static uint32_t SimAdcCalibrations = 0;
+static uint8_t SimPinMode[4][16];
+static uint8_t SimIrqEnabled[SIM_IRQ_COUNT];
+
+void Sim_Reset(void)
+{
+    memset(&Sim_GPIOA, 0, sizeof(Sim_GPIOA));
+    memset(&Sim_GPIOB, 0, sizeof(Sim_GPIOB));
+    memset(&Sim_GPIOC, 0, sizeof(Sim_GPIOC));
+    memset(&Sim_GPIOD, 0, sizeof(Sim_GPIOD));
+    memset(&Sim_AFIO, 0, sizeof(Sim_AFIO));
+    memset(&Sim_EXTI, 0, sizeof(Sim_EXTI));
+    memset(&Sim_ADC1, 0, sizeof(Sim_ADC1));
+    memset(&Sim_DMA1_Channel1, 0, sizeof(Sim_DMA1_Channel1));
+    memset(SimAdcSequence, 0, sizeof(SimAdcSequence));
+    memset(SimIrqEnabled, 0, sizeof(SimIrqEnabled));
+    memset(SimPinMode, SIM_PIN_MODE_NONE, sizeof(SimPinMode));
+
+    SimDma1Isr = 0;
+    SimDmaReload = 0;
+    SimAdcRunning = 0;
+    SimAdcChannelCount = 0;
+    SimAdcCalibrations = 0;
+    Sim_CycleCounter = 0;
+    Sim_CycleCounterEnabled = 0;
+}
+
+uint32_t Sim_AdcConvert(const uint16_t *Samples, uint32_t Count)
+{
+    uint32_t done = 0;
+
+    while (done < Count)
+    {
+        if (!SimAdcRunning || !(DMA1_Channel1->CCR & DMA_CCR1_EN) || (DMA1_Channel1->CNDTR == 0u)) break;
+
+        // ADC ghi DR, DMA chép DR vào bộ nhớ đích
+        ADC1->DR = Samples[done++];
+        volatile uint16_t *mem = (volatile uint16_t *)DMA1_Channel1->CMAR;
+        mem[SimDmaReload - DMA1_Channel1->CNDTR] = (uint16_t)ADC1->DR;
+        DMA1_Channel1->CNDTR--;
+
+        if (DMA1_Channel1->CNDTR == (SimDmaReload / 2u))
+        {
+            SimDma1Isr |= SIM_DMA_HTIF1 | SIM_DMA_GIF1;
+        }
+
+        if (DMA1_Channel1->CNDTR == 0u)
+        {
+            SimDma1Isr |= SIM_DMA_TCIF1 | SIM_DMA_GIF1;
+            if (DMA1_Channel1->CCR & DMA_CCR1_CIRC) DMA1_Channel1->CNDTR = SimDmaReload;
+        }
+    }
+
+    return done;
+}
+
+uint8_t Sim_GetAdcChannel(uint8_t Rank)
+{
+    if ((Rank == 0u) || (Rank > 16u)) return 0xFFu;
+    return SimAdcSequence[Rank - 1u];
+}
+
+uint8_t Sim_GetAdcChannelCount(void)
+{
+    return SimAdcChannelCount;
+}
+
+uint32_t Sim_GetAdcCalibrationCount(void)
+{
+    return SimAdcCalibrations;
+}
+
+/* Chỉ số 0..3 của GPIOA..GPIOD, 0xFF nếu không phải port giả lập */
+static uint8_t Sim_GpioIndex(const GPIO_TypeDef *GPIOx)
+{
+    if (GPIOx == GPIOA) return 0;
+    if (GPIOx == GPIOB) return 1;
+    if (GPIOx == GPIOC) return 2;
+    if (GPIOx == GPIOD) return 3;
+    return 0xFFu;
+}
+
+uint8_t Sim_GetPinMode(const GPIO_TypeDef *GPIOx, uint8_t Pin)
+{
+    uint8_t port = Sim_GpioIndex(GPIOx);
+
+    if ((port == 0xFFu) || (Pin >= 16u)) return SIM_PIN_MODE_NONE;
+    return SimPinMode[port][Pin];
+}
+
+uint8_t Sim_IsIrqEnabled(IRQn_Type IRQn)
+{
+    return SimIrqEnabled[(uint32_t)IRQn % SIM_IRQ_COUNT];
+}
+
+/*---------------------------------- CMSIS ----------------------------------*/
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)  { SimIrqEnabled[(uint32_t)IRQn % SIM_IRQ_COUNT] = 1; }
+void NVIC_DisableIRQ(IRQn_Type IRQn) { SimIrqEnabled[(uint32_t)IRQn % SIM_IRQ_COUNT] = 0; }
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority) { (void)IRQn; (void)priority; }
+void __DMB(void) { }
+
+uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0;
+
+    for (uint8_t i = 0; i < 32u; i++)
+    {
+        if (value & (1u << i)) result |= 1u << (31u - i);
+    }
+
+    return result;
+}
+
+uint8_t __CLZ(uint32_t value)
+{
+    uint8_t count = 0;
+
+    while ((count < 32u) && !(value & (0x80000000u >> count))) count++;
+
+    return count;
+}
+
+/*---------------------------------- GPIO -----------------------------------*/
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct)
+{
+    uint8_t port = Sim_GpioIndex(GPIOx);
+
+    if (port == 0xFFu) return;
+
+    // Ghi nhận mode của mọi chân có trong GPIO_Pin
+    for (uint8_t pin = 0; pin < 16u; pin++)
+    {
+        if (GPIO_InitStruct->GPIO_Pin & (1u << pin)) SimPinMode[port][pin] = (uint8_t)GPIO_InitStruct->GPIO_Mode;
+    }
+}
+
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) { return (GPIOx->IDR & GPIO_Pin) ? Bit_SET : Bit_RESET; }
+uint16_t GPIO_ReadInputData(GPIO_TypeDef* GPIOx) { return (uint16_t)GPIOx->IDR; }
+uint16_t GPIO_ReadOutputData(GPIO_TypeDef* GPIOx) { return (uint16_t)GPIOx->ODR; }
+void GPIO_Write(GPIO_TypeDef* GPIOx, uint16_t PortVal) { GPIOx->ODR = PortVal; }
+
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal)
+{
+    if (BitVal != Bit_RESET) GPIOx->ODR |= GPIO_Pin;
+    else GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+}
+
+void GPIO_EXTILineConfig(uint8_t GPIO_PortSource, uint8_t GPIO_PinSource)
+{
+    uint32_t shift = (uint32_t)(GPIO_PinSource & 0x03u) * 4u;
+
+    AFIO->EXTICR[GPIO_PinSource >> 2] &= ~((uint32_t)0x0F << shift);
+    AFIO->EXTICR[GPIO_PinSource >> 2] |= (uint32_t)GPIO_PortSource << shift;
+}
+
+/*------------------------------- RCC / EXTI --------------------------------*/
+
+void RCC_AHBPeriphClockCmd(uint32_t RCC_AHBPeriph, FunctionalState NewState) { (void)RCC_AHBPeriph; (void)NewState; }
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState) { (void)RCC_APB2Periph; (void)NewState; }
+void RCC_ADCCLKConfig(uint32_t RCC_PCLK2) { (void)RCC_PCLK2; }
+
+void EXTI_Init(EXTI_InitTypeDef* EXTI_InitStruct)
+{
+    uint32_t line = EXTI_InitStruct->EXTI_Line;
+
+    EXTI->IMR &= ~line;
+    EXTI->RTSR &= ~line;
+    EXTI->FTSR &= ~line;
+    if (EXTI_InitStruct->EXTI_LineCmd == DISABLE) return;
+
+    EXTI->IMR |= line;
+    if (EXTI_InitStruct->EXTI_Trigger != EXTI_Trigger_Falling) EXTI->RTSR |= line;
+    if (EXTI_InitStruct->EXTI_Trigger != EXTI_Trigger_Rising) EXTI->FTSR |= line;
+}
+
+// PR là thanh ghi ghi 1 để xóa, bit ghi 0 giữ nguyên
+void EXTI_ClearITPendingBit(uint32_t EXTI_Line) { EXTI->PR &= ~EXTI_Line; }
+
+/*----------------------------------- ADC -----------------------------------*/
+
+void ADC_Init(ADC_TypeDef* ADCx, ADC_InitTypeDef* ADC_InitStruct)
+{
+    (void)ADCx;
+    SimAdcChannelCount = ADC_InitStruct->ADC_NbrOfChannel;
+}
+
+void ADC_Cmd(ADC_TypeDef* ADCx, FunctionalState NewState)
+{
+    if (NewState != DISABLE)
+    {
+        ADCx->CR2 |= ADC_CR2_ADON;
+    }
+    else
+    {
+        ADCx->CR2 &= ~ADC_CR2_ADON;
+        SimAdcRunning = 0;
+    }
+}
+
+void ADC_DMACmd(ADC_TypeDef* ADCx, FunctionalState NewState) { (void)ADCx; (void)NewState; }
+
+void ADC_RegularChannelConfig(ADC_TypeDef* ADCx, uint8_t ADC_Channel, uint8_t Rank, uint8_t ADC_SampleTime)
+{
+    (void)ADCx;
+    (void)ADC_SampleTime;
+    if ((Rank >= 1u) && (Rank <= 16u)) SimAdcSequence[Rank - 1u] = ADC_Channel;
+}
+
+void ADC_ResetCalibration(ADC_TypeDef* ADCx) { (void)ADCx; }
+FlagStatus ADC_GetResetCalibrationStatus(ADC_TypeDef* ADCx) { (void)ADCx; return RESET; }
+void ADC_StartCalibration(ADC_TypeDef* ADCx)
+{
+    // Hiệu chuẩn chỉ chạy khi ADC đang được cấp nguồn
+    if (ADCx->CR2 & ADC_CR2_ADON) SimAdcCalibrations++;
+}
+FlagStatus ADC_GetCalibrationStatus(ADC_TypeDef* ADCx) { (void)ADCx; return RESET; }
+
+void ADC_SoftwareStartConvCmd(ADC_TypeDef* ADCx, FunctionalState NewState)
+{
+    if ((NewState != DISABLE) && (ADCx->CR2 & ADC_CR2_ADON)) SimAdcRunning = 1;
+}
+
+/*----------------------------------- DMA -----------------------------------*/
+
+void DMA_DeInit(DMA_Channel_TypeDef* DMAy_Channelx)
+{
+    memset((void *)DMAy_Channelx, 0, sizeof(*DMAy_Channelx));
+    SimDma1Isr = 0;
+    SimDmaReload = 0;
+}
+
+void DMA_Init(DMA_Channel_TypeDef* DMAy_Channelx, DMA_InitTypeDef* DMA_InitStruct)
+{
+    DMAy_Channelx->CPAR  = DMA_InitStruct->DMA_PeripheralBaseAddr;
+    DMAy_Channelx->CMAR  = DMA_InitStruct->DMA_MemoryBaseAddr;
+    DMAy_Channelx->CNDTR = DMA_InitStruct->DMA_BufferSize;
+    DMAy_Channelx->CCR   = DMA_InitStruct->DMA_DIR | DMA_InitStruct->DMA_Mode |
+                           DMA_InitStruct->DMA_PeripheralInc | DMA_InitStruct->DMA_MemoryInc |
+                           DMA_InitStruct->DMA_PeripheralDataSize | DMA_InitStruct->DMA_MemoryDataSize |
+                           DMA_InitStruct->DMA_Priority | DMA_InitStruct->DMA_M2M;
+    SimDmaReload = DMA_InitStruct->DMA_BufferSize;
+}
+
+void DMA_Cmd(DMA_Channel_TypeDef* DMAy_Channelx, FunctionalState NewState)
+{
+    if (NewState != DISABLE) DMAy_Channelx->CCR |= DMA_CCR1_EN;
+    else DMAy_Channelx->CCR &= ~DMA_CCR1_EN;
+}
+
+void DMA_ITConfig(DMA_Channel_TypeDef* DMAy_Channelx, uint32_t DMA_IT, FunctionalState NewState)
+{
+    if (NewState != DISABLE) DMAy_Channelx->CCR |= DMA_IT;
+    else DMAy_Channelx->CCR &= ~DMA_IT;
+}
+
+void DMA_SetCurrDataCounter(DMA_Channel_TypeDef* DMAy_Channelx, uint16_t DataNumber)
+{
+    DMAy_Channelx->CNDTR = DataNumber;
+    SimDmaReload = DataNumber;
+}
+
+ITStatus DMA_GetITStatus(uint32_t DMAy_IT)
+{
+    return (SimDma1Isr & DMAy_IT & SIM_DMA_CH1) ? SET : RESET;
+}
+
+void DMA_ClearITPendingBit(uint32_t DMAy_IT)
+{
+    // Xóa cờ GL sẽ xóa toàn bộ cờ của kênh
+    if ((DMAy_IT & SIM_DMA_CH1) == SIM_DMA_GIF1) SimDma1Isr &= ~SIM_DMA_CH1;
+    else SimDma1Isr &= ~(DMAy_IT & SIM_DMA_CH1);
+}
@@ -0,0 +1,57 @@
+/***************************************************************************
+ * @file    Spl_Sim.h
+ * @brief   Hàm điều khiển bộ giả lập SPL dùng trong test trên máy host
+ * @details Bộ giả lập giữ thanh ghi GPIO/AFIO/EXTI/ADC1/DMA1 Channel1 trong RAM.
+ *          Test cho "ADC chuyển đổi" bằng Sim_AdcConvert: mỗi mẫu được đặt vào
+ *          ADC1->DR rồi DMA chép vào bộ nhớ đích, cờ HT/TC được bật giống phần
+ *          cứng. Mức chân input được đặt trực tiếp trong GPIOx->IDR, cờ EXTI
+ *          trong EXTI->PR (EXTI_ClearITPendingBit xóa theo kiểu ghi 1).
+ ***************************************************************************/
+#ifndef SPL_SIM_H
+#define SPL_SIM_H
+
+#include "stm32f10x.h"
+
+/**
+ * @brief Đưa toàn bộ thanh ghi giả lập về trạng thái reset
+ */
+void Sim_Reset(void);
+
+/**
+ * @brief Giả lập ADC chuyển đổi Count mẫu liên tiếp theo thứ tự quét
+ *
+ * @return Số mẫu đã được DMA chép (0 nếu ADC chưa chạy hoặc DMA đang tắt)
+ */
+uint32_t Sim_AdcConvert(const uint16_t *Samples, uint32_t Count);
+
+/**
+ * @brief Lấy kênh ADC được cấu hình ở Rank (1..16)
+ */
+uint8_t Sim_GetAdcChannel(uint8_t Rank);
+
+/**
+ * @brief Lấy số kênh ADC_NbrOfChannel đã truyền vào ADC_Init
+ */
+uint8_t Sim_GetAdcChannelCount(void);
+
+/**
+ * @brief Lấy số lần ADC_StartCalibration được gọi khi ADON = 1
+ */
+uint32_t Sim_GetAdcCalibrationCount(void);
+
+/// @brief Giá trị Sim_GetPinMode khi chân chưa qua GPIO_Init
+#define SIM_PIN_MODE_NONE   0xFFu
+
+/**
+ * @brief Lấy GPIO_Mode của lần GPIO_Init gần nhất cho chân Pin (0..15) của GPIOx
+ *
+ * @return GPIOMode_TypeDef, hoặc SIM_PIN_MODE_NONE nếu chân chưa được khởi tạo
+ */
+uint8_t Sim_GetPinMode(const GPIO_TypeDef *GPIOx, uint8_t Pin);
+
+/**
+ * @brief Kiểm tra IRQ đang được bật trong NVIC giả lập
+ */
+uint8_t Sim_IsIrqEnabled(IRQn_Type IRQn);
+
+#endif /* SPL_SIM_H */
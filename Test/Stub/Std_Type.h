@@ -0,0 +1,35 @@
+/***************************************************************************
+ * @file    Std_Type.h
+ * @brief   Bản Std_Type tối thiểu để build driver trên máy host (test)
+ ***************************************************************************/
+#ifndef STD_TYPE_H
+#define STD_TYPE_H
+
+#include <stdint.h>
+
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int8_t   sint8;
+typedef int16_t  sint16;
+typedef int32_t  sint32;
+
+typedef uint8 Std_ReturnType;
+#define E_OK        0x00u
+#define E_NOT_OK    0x01u
+
+#define STD_ON      0x01u
+#define STD_OFF     0x00u
+
+#define NULL_PTR    ((void *)0)
+
+typedef struct
+{
+    uint16 vendorID;
+    uint16 moduleID;
+    uint8  sw_major_version;
+    uint8  sw_minor_version;
+    uint8  sw_patch_version;
+} Std_VersionInfoType;
+
+#endif /* STD_TYPE_H */
@@ -0,0 +1,97 @@
+/***************************************************************************
+ * @file    stm32f10x.h
+ * @brief   Bản giả lập thanh ghi STM32F10x cho test trên máy host
+ * @details Thanh ghi ngoại vi là biến toàn cục (Spl_Sim.c) thay vì địa chỉ
+ *          cố định. Địa chỉ bộ nhớ dùng uintptr_t để không bị cắt trên host 64 bit.
+ ***************************************************************************/
+#ifndef STM32F10X_H
+#define STM32F10X_H
+
+#include <stdint.h>
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+
+typedef enum
+{
+    EXTI0_IRQn         = 6,
+    EXTI1_IRQn         = 7,
+    EXTI2_IRQn         = 8,
+    EXTI3_IRQn         = 9,
+    EXTI4_IRQn         = 10,
+    DMA1_Channel1_IRQn = 11,
+    EXTI9_5_IRQn       = 23,
+    EXTI15_10_IRQn     = 40
+} IRQn_Type;
+
+typedef struct
+{
+    volatile uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t EVCR, MAPR, EXTICR[4];
+} AFIO_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t IMR, EMR, RTSR, FTSR, SWIER, PR;
+} EXTI_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t SR, CR1, CR2, SMPR1, SMPR2;
+    volatile uint32_t JOFR[4];
+    volatile uint32_t HTR, LTR, SQR1, SQR2, SQR3, JSQR;
+    volatile uint32_t JDR[4];
+    volatile uint32_t DR;
+} ADC_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t  CCR;
+    volatile uint32_t  CNDTR;
+    volatile uintptr_t CPAR;
+    volatile uintptr_t CMAR;
+} DMA_Channel_TypeDef;
+
+extern GPIO_TypeDef Sim_GPIOA, Sim_GPIOB, Sim_GPIOC, Sim_GPIOD;
+extern AFIO_TypeDef Sim_AFIO;
+extern EXTI_TypeDef Sim_EXTI;
+extern ADC_TypeDef Sim_ADC1;
+extern DMA_Channel_TypeDef Sim_DMA1_Channel1;
+
+#define GPIOA           (&Sim_GPIOA)
+#define GPIOB           (&Sim_GPIOB)
+#define GPIOC           (&Sim_GPIOC)
+#define GPIOD           (&Sim_GPIOD)
+#define AFIO            (&Sim_AFIO)
+#define EXTI            (&Sim_EXTI)
+#define ADC1            (&Sim_ADC1)
+#define DMA1_Channel1   (&Sim_DMA1_Channel1)
+
+#define ADC_CR2_ADON    ((uint32_t)0x00000001)
+
+#define DMA_CCR1_EN     ((uint32_t)0x00000001)
+#define DMA_CCR1_TCIE   ((uint32_t)0x00000002)
+#define DMA_CCR1_HTIE   ((uint32_t)0x00000004)
+#define DMA_CCR1_CIRC   ((uint32_t)0x00000020)
+
+/* Bộ đếm chu kỳ giả lập thay cho DWT->CYCCNT, xem DIO_EDGE_TIMESTAMP trong Makefile */
+extern volatile uint32_t Sim_CycleCounter;
+extern volatile uint8_t Sim_CycleCounterEnabled;
+
+/* CMSIS core */
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+uint32_t __RBIT(uint32_t value);
+uint8_t __CLZ(uint32_t value);
+void __DMB(void);
+
+#ifdef USE_STDPERIPH_DRIVER
+#include "stm32f10x_conf.h"
+#endif
+
+#endif /* STM32F10X_H */
@@ -0,0 +1,38 @@
+/***************************************************************************
+ * @file    stm32f10x_adc.h
+ * @brief   Bản giả lập API ADC của SPL cho test trên máy host
+ ***************************************************************************/
+#ifndef STM32F10X_ADC_H
+#define STM32F10X_ADC_H
+
+#include "stm32f10x.h"
+
+typedef struct
+{
+    uint32_t ADC_Mode;
+    FunctionalState ADC_ScanConvMode;
+    FunctionalState ADC_ContinuousConvMode;
+    uint32_t ADC_ExternalTrigConv;
+    uint32_t ADC_DataAlign;
+    uint8_t ADC_NbrOfChannel;
+} ADC_InitTypeDef;
+
+#define ADC_Mode_Independent        ((uint32_t)0x00000000)
+#define ADC_ExternalTrigConv_None   ((uint32_t)0x000E0000)
+#define ADC_DataAlign_Right         ((uint32_t)0x00000000)
+
+#define ADC_SampleTime_1Cycles5     ((uint8_t)0x00)
+#define ADC_SampleTime_55Cycles5    ((uint8_t)0x05)
+#define ADC_SampleTime_239Cycles5   ((uint8_t)0x07)
+
+void ADC_Init(ADC_TypeDef* ADCx, ADC_InitTypeDef* ADC_InitStruct);
+void ADC_Cmd(ADC_TypeDef* ADCx, FunctionalState NewState);
+void ADC_DMACmd(ADC_TypeDef* ADCx, FunctionalState NewState);
+void ADC_RegularChannelConfig(ADC_TypeDef* ADCx, uint8_t ADC_Channel, uint8_t Rank, uint8_t ADC_SampleTime);
+void ADC_ResetCalibration(ADC_TypeDef* ADCx);
+FlagStatus ADC_GetResetCalibrationStatus(ADC_TypeDef* ADCx);
+void ADC_StartCalibration(ADC_TypeDef* ADCx);
+FlagStatus ADC_GetCalibrationStatus(ADC_TypeDef* ADCx);
+void ADC_SoftwareStartConvCmd(ADC_TypeDef* ADCx, FunctionalState NewState);
+
+#endif /* STM32F10X_ADC_H */
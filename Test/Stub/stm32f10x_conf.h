@@ -0,0 +1,15 @@
+/***************************************************************************
+ * @file    stm32f10x_conf.h
+ * @brief   Bản giả lập stm32f10x_conf.h: kéo các header SPL giả lập vào
+ *          stm32f10x.h giống như cấu hình SPL thật (USE_STDPERIPH_DRIVER)
+ ***************************************************************************/
+#ifndef STM32F10X_CONF_H
+#define STM32F10X_CONF_H
+
+#include "stm32f10x_adc.h"
+#include "stm32f10x_dma.h"
+#include "stm32f10x_exti.h"
+#include "stm32f10x_gpio.h"
+#include "stm32f10x_rcc.h"
+
+#endif /* STM32F10X_CONF_H */
@@ -0,0 +1,51 @@
+/***************************************************************************
+ * @file    stm32f10x_dma.h
+ * @brief   Bản giả lập API DMA của SPL cho test trên máy host
+ * @details Trường địa chỉ dùng uintptr_t (trên SPL thật là uint32_t).
+ ***************************************************************************/
+#ifndef STM32F10X_DMA_H
+#define STM32F10X_DMA_H
+
+#include "stm32f10x.h"
+
+typedef struct
+{
+    uintptr_t DMA_PeripheralBaseAddr;
+    uintptr_t DMA_MemoryBaseAddr;
+    uint32_t DMA_DIR;
+    uint32_t DMA_BufferSize;
+    uint32_t DMA_PeripheralInc;
+    uint32_t DMA_MemoryInc;
+    uint32_t DMA_PeripheralDataSize;
+    uint32_t DMA_MemoryDataSize;
+    uint32_t DMA_Mode;
+    uint32_t DMA_Priority;
+    uint32_t DMA_M2M;
+} DMA_InitTypeDef;
+
+#define DMA_DIR_PeripheralSRC               ((uint32_t)0x00000000)
+#define DMA_PeripheralInc_Disable           ((uint32_t)0x00000000)
+#define DMA_MemoryInc_Enable                ((uint32_t)0x00000080)
+#define DMA_PeripheralDataSize_HalfWord     ((uint32_t)0x00000100)
+#define DMA_MemoryDataSize_HalfWord         ((uint32_t)0x00000400)
+#define DMA_Mode_Circular                   ((uint32_t)0x00000020)
+#define DMA_Mode_Normal                     ((uint32_t)0x00000000)
+#define DMA_Priority_High                   ((uint32_t)0x00002000)
+#define DMA_M2M_Disable                     ((uint32_t)0x00000000)
+
+#define DMA_IT_TC                           ((uint32_t)0x00000002)
+#define DMA_IT_HT                           ((uint32_t)0x00000004)
+
+#define DMA1_IT_GL1                         ((uint32_t)0x10000001)
+#define DMA1_IT_TC1                         ((uint32_t)0x10000002)
+#define DMA1_IT_HT1                         ((uint32_t)0x10000004)
+
+void DMA_DeInit(DMA_Channel_TypeDef* DMAy_Channelx);
+void DMA_Init(DMA_Channel_TypeDef* DMAy_Channelx, DMA_InitTypeDef* DMA_InitStruct);
+void DMA_Cmd(DMA_Channel_TypeDef* DMAy_Channelx, FunctionalState NewState);
+void DMA_ITConfig(DMA_Channel_TypeDef* DMAy_Channelx, uint32_t DMA_IT, FunctionalState NewState);
+void DMA_SetCurrDataCounter(DMA_Channel_TypeDef* DMAy_Channelx, uint16_t DataNumber);
+ITStatus DMA_GetITStatus(uint32_t DMAy_IT);
+void DMA_ClearITPendingBit(uint32_t DMAy_IT);
+
+#endif /* STM32F10X_DMA_H */
@@ -0,0 +1,30 @@
+/***************************************************************************
+ * @file    stm32f10x_exti.h
+ * @brief   Bản giả lập API EXTI của SPL cho test trên máy host
+ ***************************************************************************/
+#ifndef STM32F10X_EXTI_H
+#define STM32F10X_EXTI_H
+
+#include "stm32f10x.h"
+
+typedef enum { EXTI_Mode_Interrupt = 0x00, EXTI_Mode_Event = 0x04 } EXTIMode_TypeDef;
+
+typedef enum
+{
+    EXTI_Trigger_Rising         = 0x08,
+    EXTI_Trigger_Falling        = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+    uint32_t EXTI_Line;
+    EXTIMode_TypeDef EXTI_Mode;
+    EXTITrigger_TypeDef EXTI_Trigger;
+    FunctionalState EXTI_LineCmd;
+} EXTI_InitTypeDef;
+
+void EXTI_Init(EXTI_InitTypeDef* EXTI_InitStruct);
+void EXTI_ClearITPendingBit(uint32_t EXTI_Line);
+
+#endif /* STM32F10X_EXTI_H */
@@ -0,0 +1,49 @@
+/***************************************************************************
+ * @file    stm32f10x_gpio.h
+ * @brief   Bản giả lập API GPIO của SPL cho test trên máy host
+ ***************************************************************************/
+#ifndef STM32F10X_GPIO_H
+#define STM32F10X_GPIO_H
+
+#include "stm32f10x.h"
+
+typedef enum
+{
+    GPIO_Speed_10MHz = 1,
+    GPIO_Speed_2MHz,
+    GPIO_Speed_50MHz
+} GPIOSpeed_TypeDef;
+
+typedef enum
+{
+    GPIO_Mode_AIN         = 0x00,
+    GPIO_Mode_IN_FLOATING = 0x04,
+    GPIO_Mode_IPD         = 0x28,
+    GPIO_Mode_IPU         = 0x48,
+    GPIO_Mode_Out_OD      = 0x14,
+    GPIO_Mode_Out_PP      = 0x10
+} GPIOMode_TypeDef;
+
+typedef enum { Bit_RESET = 0, Bit_SET } BitAction;
+
+typedef struct
+{
+    uint16_t GPIO_Pin;
+    GPIOSpeed_TypeDef GPIO_Speed;
+    GPIOMode_TypeDef GPIO_Mode;
+} GPIO_InitTypeDef;
+
+#define GPIO_PortSourceGPIOA    ((uint8_t)0x00)
+#define GPIO_PortSourceGPIOB    ((uint8_t)0x01)
+#define GPIO_PortSourceGPIOC    ((uint8_t)0x02)
+#define GPIO_PortSourceGPIOD    ((uint8_t)0x03)
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct);
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+uint16_t GPIO_ReadInputData(GPIO_TypeDef* GPIOx);
+uint16_t GPIO_ReadOutputData(GPIO_TypeDef* GPIOx);
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal);
+void GPIO_Write(GPIO_TypeDef* GPIOx, uint16_t PortVal);
+void GPIO_EXTILineConfig(uint8_t GPIO_PortSource, uint8_t GPIO_PinSource);
+
+#endif /* STM32F10X_GPIO_H */
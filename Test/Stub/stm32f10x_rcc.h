@@ -0,0 +1,25 @@
+/***************************************************************************
+ * @file    stm32f10x_rcc.h
+ * @brief   Bản giả lập API RCC của SPL cho test trên máy host
+ ***************************************************************************/
+#ifndef STM32F10X_RCC_H
+#define STM32F10X_RCC_H
+
+#include "stm32f10x.h"
+
+#define RCC_AHBPeriph_DMA1      ((uint32_t)0x00000001)
+
+#define RCC_APB2Periph_AFIO     ((uint32_t)0x00000001)
+#define RCC_APB2Periph_GPIOA    ((uint32_t)0x00000004)
+#define RCC_APB2Periph_GPIOB    ((uint32_t)0x00000008)
+#define RCC_APB2Periph_GPIOC    ((uint32_t)0x00000010)
+#define RCC_APB2Periph_GPIOD    ((uint32_t)0x00000020)
+#define RCC_APB2Periph_ADC1     ((uint32_t)0x00000200)
+
+#define RCC_PCLK2_Div6          ((uint32_t)0x00008000)
+
+void RCC_AHBPeriphClockCmd(uint32_t RCC_AHBPeriph, FunctionalState NewState);
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState);
+void RCC_ADCCLKConfig(uint32_t RCC_PCLK2);
+
+#endif /* STM32F10X_RCC_H */
@@ -0,0 +1,25 @@
+/***************************************************************************
+ * @file    Test.h
+ * @brief   Macro kiểm tra tối giản cho test driver trên máy host
+ ***************************************************************************/
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+
+static int TestFailures = 0;
+
+/// @brief Ghi nhận lỗi nếu điều kiện sai, test vẫn chạy tiếp
+#define TEST_CHECK(cond) \
+    do { if (!(cond)) { printf("%s:%d: FAIL: %s\n", __FILE__, __LINE__, #cond); TestFailures++; } } while (0)
+
+/// @brief So sánh hai giá trị nguyên, in cả hai giá trị khi sai
+#define TEST_CHECK_EQ(actual, expected) \
+    do { long a_ = (long)(actual), e_ = (long)(expected); \
+         if (a_ != e_) { printf("%s:%d: FAIL: %s == %ld, expected %ld\n", __FILE__, __LINE__, #actual, a_, e_); TestFailures++; } } while (0)
+
+/// @brief Kết thúc main: in kết quả và trả mã thoát
+#define TEST_RESULT(name) \
+    (printf("%s: %s\n", (name), (TestFailures == 0) ? "PASS" : "FAIL"), (TestFailures == 0) ? 0 : 1)
+
+#endif /* TEST_H */
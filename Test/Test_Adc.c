@@ -0,0 +1,270 @@
+/***************************************************************************
+ * @file    Test_Adc.c
+ * @brief   Test driver Adc trên máy host với ADC1/DMA1 giả lập
+ * @details Mẫu được đưa qua Sim_AdcConvert, ngắt DMA được gọi trực tiếp
+ *          bằng DMA1_Channel1_IRQHandler khi cờ HT/TC được bật.
+ ***************************************************************************/
+
+#include "Test.h"
+#include "Spl_Sim.h"
+#include "Adc.h"
+
+void DMA1_Channel1_IRQHandler(void);
+
+/* Cấu hình Port riêng cho test: 3 kênh hợp lệ, 1 DIO, 1 trùng, 1 không có kênh ADC */
+static const Port_PinConfigType TestPins[] = {
+    { .PortID = PORT_ID_A, .PinID = 0,  .PinMode = PORT_PIN_MODE_ADC, .Direction = PORT_PIN_IN },  // ADC kênh 0
+    { .PortID = PORT_ID_B, .PinID = 24, .PinMode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_IN },  // PB8 DIO
+    { .PortID = PORT_ID_C, .PinID = 37, .PinMode = PORT_PIN_MODE_ADC, .Direction = PORT_PIN_IN },  // PC5 -> kênh 15
+    { .PortID = PORT_ID_B, .PinID = 17, .PinMode = PORT_PIN_MODE_ADC, .Direction = PORT_PIN_IN },  // PB1 -> kênh 9
+    { .PortID = PORT_ID_A, .PinID = 0,  .PinMode = PORT_PIN_MODE_ADC, .Direction = PORT_PIN_IN },  // trùng PA0
+    { .PortID = PORT_ID_D, .PinID = 50, .PinMode = PORT_PIN_MODE_ADC, .Direction = PORT_PIN_IN },  // PD2 không có kênh
+};
+
+static const Port_ConfigType TestPortConfig = {
+    .PinCfgType = TestPins,
+    .PortCfg_PinsCount = sizeof(TestPins) / sizeof(TestPins[0])
+};
+
+#define TEST_CHANNELS   3u
+
+static uint8 NotifyCount = 0;
+static Adc_BufferHalfType NotifyHalf[8];
+
+static void Test_Notification(Adc_BufferHalfType Half)
+{
+    if (NotifyCount < 8u) NotifyHalf[NotifyCount] = Half;
+    NotifyCount++;
+}
+
+/* Khởi tạo lại bộ giả lập và driver với cấu hình mới rồi bắt đầu quét */
+static void Test_Start(const Adc_ConfigType *Config)
+{
+    Adc_StopScan();
+    Sim_Reset();
+    NotifyCount = 0;
+
+    Adc_Init(Config);
+    Adc_StartScan();
+}
+
+/* Chép một vòng quét 3 kênh Samples lần, giá trị kênh ch ở vòng s = Base[ch] + s * Step */
+static void Test_ConvertScans(const uint16 Base[TEST_CHANNELS], uint16 Step, uint8 Scans)
+{
+    for (uint8 s = 0; s < Scans; s++)
+    {
+        uint16 scan[TEST_CHANNELS];
+        for (uint8 ch = 0; ch < TEST_CHANNELS; ch++) scan[ch] = (uint16)(Base[ch] + s * Step);
+        TEST_CHECK_EQ(Sim_AdcConvert(scan, TEST_CHANNELS), TEST_CHANNELS);
+    }
+}
+
+static void Test_ScanSequence(void)
+{
+    const Adc_ConfigType config = {
+        .PortConfig = &TestPortConfig, .SampleTime = ADC_SampleTime_55Cycles5,
+        .SamplesPerChannel = 1, .Filter = ADC_FILTER_NONE, .Notification = NULL_PTR
+    };
+
+    Test_Start(&config);
+
+    TEST_CHECK_EQ(Adc_GetChannelCount(), TEST_CHANNELS);
+    TEST_CHECK_EQ(Sim_GetAdcChannelCount(), TEST_CHANNELS);
+    TEST_CHECK_EQ(Sim_GetAdcChannel(1), 0);
+    TEST_CHECK_EQ(Sim_GetAdcChannel(2), 15);
+    TEST_CHECK_EQ(Sim_GetAdcChannel(3), 9);
+    TEST_CHECK_EQ(Adc_GetStatus(), ADC_BUSY);
+    TEST_CHECK(Sim_IsIrqEnabled(DMA1_Channel1_IRQn));
+}
+
+static void Test_InitRejected(void)
+{
+    const Port_PinConfigType dioPins[] = {
+        { .PortID = PORT_ID_B, .PinID = 24, .PinMode = PORT_PIN_MODE_DIO, .Direction = PORT_PIN_IN },
+    };
+    const Port_ConfigType dioPortConfig = { .PinCfgType = dioPins, .PortCfg_PinsCount = 1 };
+    const Adc_ConfigType config = {
+        .PortConfig = &TestPortConfig, .SampleTime = ADC_SampleTime_55Cycles5,
+        .SamplesPerChannel = 1, .Filter = ADC_FILTER_NONE, .Notification = Test_Notification
+    };
+    const Adc_ConfigType noChannel = {
+        .PortConfig = &dioPortConfig, .SampleTime = ADC_SampleTime_55Cycles5,
+        .SamplesPerChannel = 1, .Filter = ADC_FILTER_NONE, .Notification = NULL_PTR
+    };
+    const uint16 scan[TEST_CHANNELS] = { 7, 8, 9 };
+    Adc_ValueType result[TEST_CHANNELS];
+
+    Test_Start(&config);
+    Adc_StopScan();
+
+    // Cấu hình không có kênh ADC bị từ chối, chuỗi quét cũ vẫn nguyên vẹn
+    Adc_Init(&noChannel);
+    TEST_CHECK_EQ(Adc_GetChannelCount(), TEST_CHANNELS);
+
+    Adc_StartScan();
+    TEST_CHECK_EQ(Sim_AdcConvert(scan, TEST_CHANNELS), TEST_CHANNELS);
+    TEST_CHECK_EQ(Sim_AdcConvert(scan, TEST_CHANNELS), TEST_CHANNELS);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 2);
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_OK);
+    TEST_CHECK_EQ(result[2], 9);
+}
+
+static void Test_FilterNone(void)
+{
+    const Adc_ConfigType config = {
+        .PortConfig = &TestPortConfig, .SampleTime = ADC_SampleTime_55Cycles5,
+        .SamplesPerChannel = 2, .Filter = ADC_FILTER_NONE, .Notification = Test_Notification
+    };
+    const uint16 first[TEST_CHANNELS]  = { 100, 200, 300 };
+    const uint16 second[TEST_CHANNELS] = { 1000, 2000, 3000 };
+    Adc_ValueType result[TEST_CHANNELS] = {0};
+
+    Test_Start(&config);
+
+    // Chưa có nửa buffer nào đầy
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_NOT_OK);
+
+    // Nửa đầu: kết quả là vòng quét cuối cùng
+    Test_ConvertScans(first, 1, 2);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 1);
+    TEST_CHECK_EQ(NotifyHalf[0], ADC_BUFFER_HALF_FIRST);
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_OK);
+    TEST_CHECK_EQ(result[0], 101);
+    TEST_CHECK_EQ(result[1], 201);
+    TEST_CHECK_EQ(result[2], 301);
+    TEST_CHECK(Sim_IsIrqEnabled(DMA1_Channel1_IRQn));
+
+    // Nửa sau
+    Test_ConvertScans(second, 5, 2);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 2);
+    TEST_CHECK_EQ(NotifyHalf[1], ADC_BUFFER_HALF_SECOND);
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_OK);
+    TEST_CHECK_EQ(result[0], 1005);
+    TEST_CHECK_EQ(result[1], 2005);
+    TEST_CHECK_EQ(result[2], 3005);
+
+    // DMA vòng lại nửa đầu
+    Test_ConvertScans(first, 2, 2);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 3);
+    TEST_CHECK_EQ(NotifyHalf[2], ADC_BUFFER_HALF_FIRST);
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_OK);
+    TEST_CHECK_EQ(result[0], 102);
+}
+
+static void Test_FilterAverage(void)
+{
+    const Adc_ConfigType config = {
+        .PortConfig = &TestPortConfig, .SampleTime = ADC_SampleTime_55Cycles5,
+        .SamplesPerChannel = 4, .Filter = ADC_FILTER_AVERAGE, .Notification = Test_Notification
+    };
+    const uint16 base[TEST_CHANNELS] = { 100, 2000, 4000 };
+    Adc_ValueType result[TEST_CHANNELS] = {0};
+    const Adc_ValueType *raw;
+
+    Test_Start(&config);
+
+    // 4 mẫu base, base+10, base+20, base+30 -> trung bình base+15
+    Test_ConvertScans(base, 10, 4);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 1);
+    TEST_CHECK_EQ(NotifyHalf[0], ADC_BUFFER_HALF_FIRST);
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_OK);
+    TEST_CHECK_EQ(result[0], 115);
+    TEST_CHECK_EQ(result[1], 2015);
+    TEST_CHECK_EQ(result[2], 4015);
+
+    // Buffer thô xen kẽ theo thứ tự quét
+    raw = Adc_GetRawBuffer(ADC_BUFFER_HALF_FIRST);
+    TEST_CHECK(raw != NULL_PTR);
+    TEST_CHECK_EQ(raw[0], 100);
+    TEST_CHECK_EQ(raw[1], 2000);
+    TEST_CHECK_EQ(raw[3], 110);
+
+    // Cả HT và TC cùng pending trong một lần vào ngắt: xử lý theo thứ tự nửa đầu, nửa sau.
+    // DMA ghi nửa sau (bước 2) rồi vòng lại nửa đầu (bước 4)
+    Test_ConvertScans(base, 2, 4);
+    Test_ConvertScans(base, 4, 4);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 3);
+    TEST_CHECK_EQ(NotifyHalf[1], ADC_BUFFER_HALF_FIRST);
+    TEST_CHECK_EQ(NotifyHalf[2], ADC_BUFFER_HALF_SECOND);
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_OK);
+    TEST_CHECK_EQ(result[0], 103);  // Nửa sau xử lý cuối: 100 + 2 * (0+1+2+3) / 4
+}
+
+static void Test_FilterOversample(void)
+{
+    const Adc_ConfigType config = {
+        .PortConfig = &TestPortConfig, .SampleTime = ADC_SampleTime_55Cycles5,
+        .SamplesPerChannel = 16, .Filter = ADC_FILTER_OVERSAMPLE, .OversampleShift = 2,
+        .Notification = Test_Notification
+    };
+    const uint16 base[TEST_CHANNELS] = { 0, 1000, 4095 };
+    const uint16 top[TEST_CHANNELS]  = { 4095, 4095, 4095 };
+    Adc_ValueType result[TEST_CHANNELS] = {0};
+
+    Test_Start(&config);
+
+    // Nửa đầu: 16 mẫu base + s -> tổng 16 * base + 120, dịch 2 bit = 4 * base + 30
+    Test_ConvertScans(base, 1, 16);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 1);
+    TEST_CHECK_EQ(NotifyHalf[0], ADC_BUFFER_HALF_FIRST);
+
+    // 16 mẫu = 4^2 -> kết quả 14 bit
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_OK);
+    TEST_CHECK_EQ(result[0], 30);
+    TEST_CHECK_EQ(result[1], 4030);
+
+    // Nửa sau: giá trị lớn nhất 4095 -> 16380, vẫn nằm trong 16 bit
+    Test_ConvertScans(top, 0, 16);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 2);
+    TEST_CHECK_EQ(NotifyHalf[1], ADC_BUFFER_HALF_SECOND);
+    TEST_CHECK_EQ(Adc_ReadGroup(result), E_OK);
+    TEST_CHECK_EQ(result[0], 16380);
+    TEST_CHECK_EQ(result[2], 16380);
+}
+
+static void Test_StopScan(void)
+{
+    const Adc_ConfigType config = {
+        .PortConfig = &TestPortConfig, .SampleTime = ADC_SampleTime_55Cycles5,
+        .SamplesPerChannel = 1, .Filter = ADC_FILTER_NONE, .Notification = Test_Notification
+    };
+    const uint16 scan[TEST_CHANNELS] = { 1, 2, 3 };
+
+    Test_Start(&config);
+    TEST_CHECK_EQ(Sim_GetAdcCalibrationCount(), 1);
+    Adc_StopScan();
+
+    // Sau khi dừng, ADC tắt nguồn nên không còn mẫu nào được chép
+    TEST_CHECK_EQ(Adc_GetStatus(), ADC_IDLE);
+    TEST_CHECK_EQ(ADC1->CR2 & ADC_CR2_ADON, 0);
+    TEST_CHECK_EQ(Sim_AdcConvert(scan, TEST_CHANNELS), 0);
+
+    // Bắt đầu lại: cấp nguồn, hiệu chuẩn lại, DMA ghi lại từ đầu buffer
+    Adc_StartScan();
+    TEST_CHECK_EQ(ADC1->CR2 & ADC_CR2_ADON, ADC_CR2_ADON);
+    TEST_CHECK_EQ(Sim_GetAdcCalibrationCount(), 2);
+    TEST_CHECK_EQ(Sim_AdcConvert(scan, TEST_CHANNELS), TEST_CHANNELS);
+    DMA1_Channel1_IRQHandler();
+    TEST_CHECK_EQ(NotifyCount, 1);
+    TEST_CHECK_EQ(NotifyHalf[0], ADC_BUFFER_HALF_FIRST);
+}
+
+int main(void)
+{
+    Test_ScanSequence();
+    Test_InitRejected();
+    Test_FilterNone();
+    Test_FilterAverage();
+    Test_FilterOversample();
+    Test_StopScan();
+
+    return TEST_RESULT("Test_Adc");
+}
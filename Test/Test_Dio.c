@@ -0,0 +1,187 @@
+/***************************************************************************
+ * @file    Test_Dio.c
+ * @brief   Test hàng đợi sự kiện cạnh của Dio trên máy host với EXTI giả lập
+ * @details Line EXTI được định tuyến qua GPIO_EXTILineConfig/EXTI_Init giả
+ *          lập, cờ pending được bật trực tiếp trong EXTI->PR rồi gọi ISR.
+ *          Timestamp lấy từ Sim_CycleCounter (xem Makefile).
+ ***************************************************************************/
+
+#include "Test.h"
+#include "Spl_Sim.h"
+#include "Dio.h"
+
+void EXTI9_5_IRQHandler(void);
+void EXTI15_10_IRQHandler(void);
+
+#define TEST_LINE(n)    ((uint32)1u << (n))
+
+/* Nối line EXTI Line tới Port PortSource với cạnh Trigger */
+static void Test_ArmLine(uint8 PortSource, uint8 Line, EXTITrigger_TypeDef Trigger)
+{
+    EXTI_InitTypeDef init = {
+        .EXTI_Line = TEST_LINE(Line), .EXTI_Mode = EXTI_Mode_Interrupt,
+        .EXTI_Trigger = Trigger, .EXTI_LineCmd = ENABLE
+    };
+
+    GPIO_EXTILineConfig(PortSource, Line);
+    EXTI_Init(&init);
+}
+
+/* Bật cờ pending của Line với timestamp Timestamp rồi chạy ISR 9_5 */
+static void Test_Fire(uint8 Line, uint32 Timestamp)
+{
+    Sim_CycleCounter = Timestamp;
+    EXTI->PR |= TEST_LINE(Line);
+    EXTI9_5_IRQHandler();
+}
+
+static void Test_Setup(void)
+{
+    Sim_Reset();
+    Dio_Init();
+}
+
+static void Test_CheckEvent(const Dio_EdgeEventType *Event, Dio_ChannelType Channel,
+                            Dio_EdgeType Edge, Dio_LevelType Level, uint32 Timestamp)
+{
+    TEST_CHECK_EQ(Event->Channel, Channel);
+    TEST_CHECK_EQ(Event->Edge, Edge);
+    TEST_CHECK_EQ(Event->Level, Level);
+    TEST_CHECK_EQ(Event->Timestamp, Timestamp);
+}
+
+static void Test_SharedLines(void)
+{
+    Dio_EdgeEventType events[8];
+
+    Test_Setup();
+    TEST_CHECK_EQ(Sim_CycleCounterEnabled, 1);
+
+    // Line 5..9: PB5 lên, PD6 lên (không pending), PC7 xuống, PA9 cả hai cạnh
+    Test_ArmLine(GPIO_PortSourceGPIOB, 5, EXTI_Trigger_Rising);
+    Test_ArmLine(GPIO_PortSourceGPIOD, 6, EXTI_Trigger_Rising);
+    Test_ArmLine(GPIO_PortSourceGPIOC, 7, EXTI_Trigger_Falling);
+    Test_ArmLine(GPIO_PortSourceGPIOA, 9, EXTI_Trigger_Rising_Falling);
+    // Line 10..15: PB10 cả hai cạnh, PA12 xuống, PD15 lên
+    Test_ArmLine(GPIO_PortSourceGPIOB, 10, EXTI_Trigger_Rising_Falling);
+    Test_ArmLine(GPIO_PortSourceGPIOA, 12, EXTI_Trigger_Falling);
+    Test_ArmLine(GPIO_PortSourceGPIOD, 15, EXTI_Trigger_Rising);
+
+    GPIOA->IDR = 0x0200u;   // PA9 đang mức cao
+    GPIOB->IDR = 0x0020u;   // PB5 cao, PB10 thấp
+    GPIOD->IDR = 0x8000u;   // PD15 cao
+
+    // Line 12 pending cùng lúc nhưng thuộc IRQ khác, ISR 9_5 không được đụng tới
+    EXTI->PR = TEST_LINE(9) | TEST_LINE(5) | TEST_LINE(12) | TEST_LINE(7);
+    Sim_CycleCounter = 1000u;
+    EXTI9_5_IRQHandler();
+
+    TEST_CHECK_EQ(EXTI->PR, TEST_LINE(12));
+    TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 8), 3);
+    Test_CheckEvent(&events[0], 16 + 5, DIO_EDGE_RISING,  STD_HIGH, 1000u);
+    Test_CheckEvent(&events[1], 32 + 7, DIO_EDGE_FALLING, STD_LOW,  1000u);
+    Test_CheckEvent(&events[2], 0 + 9,  DIO_EDGE_BOTH,    STD_HIGH, 1000u);
+
+    EXTI->PR |= TEST_LINE(15) | TEST_LINE(10);
+    Sim_CycleCounter = 2000u;
+    EXTI15_10_IRQHandler();
+
+    TEST_CHECK_EQ(EXTI->PR, 0);
+    TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 8), 3);
+    Test_CheckEvent(&events[0], 16 + 10, DIO_EDGE_BOTH,    STD_LOW,  2000u);
+    Test_CheckEvent(&events[1], 0 + 12,  DIO_EDGE_FALLING, STD_LOW,  2000u);
+    Test_CheckEvent(&events[2], 48 + 15, DIO_EDGE_RISING,  STD_HIGH, 2000u);
+
+    // Không có gì pending thì ISR không đẩy sự kiện
+    EXTI9_5_IRQHandler();
+    TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 8), 0);
+    TEST_CHECK_EQ(Dio_GetEdgeEventOverflowCount(), 0);
+}
+
+static void Test_BatchDrainWrap(void)
+{
+    Dio_EdgeEventType events[8];
+    uint32 expected = 0;
+
+    Test_Setup();
+    Test_ArmLine(GPIO_PortSourceGPIOB, 5, EXTI_Trigger_Rising);
+
+    // 2 lượt x 20 sự kiện: lượt thứ hai đi qua cuối mảng 32 phần tử
+    for (uint8 round = 0; round < 2u; round++)
+    {
+        for (uint8 i = 0; i < 20u; i++)
+        {
+            Test_Fire(5, expected + i);
+        }
+
+        TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 8), 8);
+        for (uint8 i = 0; i < 8u; i++) TEST_CHECK_EQ(events[i].Timestamp, expected++);
+        TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 8), 8);
+        for (uint8 i = 0; i < 8u; i++) TEST_CHECK_EQ(events[i].Timestamp, expected++);
+        TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 8), 4);
+        for (uint8 i = 0; i < 4u; i++) TEST_CHECK_EQ(events[i].Timestamp, expected++);
+        TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 8), 0);
+    }
+
+    TEST_CHECK_EQ(Dio_ReadEdgeEvents(NULL_PTR, 8), 0);
+    TEST_CHECK_EQ(Dio_GetEdgeEventOverflowCount(), 0);
+}
+
+static void Test_Overflow(void)
+{
+    Dio_EdgeEventType events[64];
+
+    Test_Setup();
+    Test_ArmLine(GPIO_PortSourceGPIOB, 5, EXTI_Trigger_Rising);
+
+    // Hàng đợi đầy giữ 32 sự kiện cũ nhất, 8 sự kiện mới bị bỏ và được đếm
+    for (uint32 i = 0; i < 40u; i++)
+    {
+        Test_Fire(5, i);
+    }
+
+    TEST_CHECK_EQ(Dio_GetEdgeEventOverflowCount(), 8);
+    TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 64), 32);
+    TEST_CHECK_EQ(events[0].Timestamp, 0);
+    TEST_CHECK_EQ(events[31].Timestamp, 31);
+
+    // Có chỗ trống lại thì sự kiện mới được nhận
+    Test_Fire(5, 100u);
+    TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 64), 1);
+    TEST_CHECK_EQ(events[0].Timestamp, 100);
+
+    // Dio_Init xóa hàng đợi và bộ đếm tràn
+    Test_Fire(5, 200u);
+    Dio_Init();
+    TEST_CHECK_EQ(Dio_GetEdgeEventOverflowCount(), 0);
+    TEST_CHECK_EQ(Dio_ReadEdgeEvents(events, 64), 0);
+}
+
+static void Test_IndexWrap(void)
+{
+    Dio_EdgeEventType event;
+    uint32 mismatches = 0;
+
+    Test_Setup();
+    Test_ArmLine(GPIO_PortSourceGPIOB, 5, EXTI_Trigger_Rising);
+
+    // Head/Tail 16 bit chạy tự do qua 65535 -> 0 mà không mất hay lặp sự kiện
+    for (uint32 i = 0; i < 70000u; i++)
+    {
+        Test_Fire(5, i);
+        if ((Dio_ReadEdgeEvents(&event, 1) != 1u) || (event.Timestamp != i)) mismatches++;
+    }
+
+    TEST_CHECK_EQ(mismatches, 0);
+    TEST_CHECK_EQ(Dio_GetEdgeEventOverflowCount(), 0);
+}
+
+int main(void)
+{
+    Test_SharedLines();
+    Test_BatchDrainWrap();
+    Test_Overflow();
+    Test_IndexWrap();
+
+    return TEST_RESULT("Test_Dio");
+}
@@ -0,0 +1,164 @@
+/***************************************************************************
+ * @file    Test_Encoder.c
+ * @brief   Test bộ giải mã Encoder trên máy host bằng chuỗi A/B ghi sẵn
+ * @details Dio_ReadPort được thay bằng ảnh port giả lập. Mỗi tick test ghi
+ *          trạng thái A/B của từng encoder vào ảnh port rồi gọi
+ *          Encoder_MainFunction, sau đó kiểm tra vị trí và số bước lỗi.
+ ***************************************************************************/
+
+#include "Test.h"
+#include "Encoder.h"
+
+#define TEST_PORT_COUNT     4u
+#define TEST_ENCODERS       3u
+
+/* Ảnh IDR của các port và số lần mỗi port được đọc */
+static Dio_PortLevelType TestPortLevel[TEST_PORT_COUNT];
+static uint32 TestPortReads[TEST_PORT_COUNT];
+
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+    if (PortId >= TEST_PORT_COUNT) return 0;
+
+    TestPortReads[PortId]++;
+    return TestPortLevel[PortId];
+}
+
+/* Encoder 0 trên port B, encoder 1 trên port A, encoder 2 có A ở port C và B ở port A */
+static const Encoder_ChannelConfigType TestChannels[TEST_ENCODERS] = {
+    { .ChannelA = 22, .ChannelB = 23 },     // PB6 / PB7
+    { .ChannelA = 6,  .ChannelB = 7  },     // PA6 / PA7
+    { .ChannelA = 32, .ChannelB = 1  },     // PC0 / PA1
+};
+
+static const Encoder_ConfigType TestConfig = {
+    .EncoderCfg = TestChannels,
+    .EncoderCount = TEST_ENCODERS
+};
+
+/* Ghi trạng thái 2 bit (A << 1) | B của một encoder vào ảnh port */
+static void Test_SetState(uint8 Encoder, uint8 State)
+{
+    Dio_ChannelType chA = TestChannels[Encoder].ChannelA;
+    Dio_ChannelType chB = TestChannels[Encoder].ChannelB;
+
+    TestPortLevel[chA / 16u] &= (Dio_PortLevelType)~(1u << (chA % 16u));
+    TestPortLevel[chA / 16u] |= (Dio_PortLevelType)(((State >> 1) & 0x01u) << (chA % 16u));
+    TestPortLevel[chB / 16u] &= (Dio_PortLevelType)~(1u << (chB % 16u));
+    TestPortLevel[chB / 16u] |= (Dio_PortLevelType)((State & 0x01u) << (chB % 16u));
+}
+
+/* Phát lại chuỗi trạng thái ghi sẵn, mỗi hàng là một tick cho cả ba encoder */
+static void Test_Replay(const uint8 Sequence[][TEST_ENCODERS], uint8 Ticks)
+{
+    for (uint8 t = 0; t < Ticks; t++)
+    {
+        for (uint8 e = 0; e < TEST_ENCODERS; e++) Test_SetState(e, Sequence[t][e]);
+        Encoder_MainFunction();
+    }
+}
+
+static void Test_Reset(const uint8 Initial[TEST_ENCODERS])
+{
+    for (uint8 p = 0; p < TEST_PORT_COUNT; p++)
+    {
+        TestPortLevel[p] = 0;
+        TestPortReads[p] = 0;
+    }
+    for (uint8 e = 0; e < TEST_ENCODERS; e++) Test_SetState(e, Initial[e]);
+
+    Encoder_Init(&TestConfig);
+}
+
+/* Thuận, nghịch và bước nhảy lỗi trên ba encoder cùng lúc */
+static void Test_ForwardReverseIllegal(void)
+{
+    static const uint8 initial[TEST_ENCODERS] = { 0, 0, 0 };
+    /*                      enc0: thuận   enc1: nghịch   enc2: nhảy lỗi */
+    static const uint8 sequence[][TEST_ENCODERS] = {
+        { 1, 2, 3 },    //  +1   -1   lỗi (00 -> 11)
+        { 3, 3, 0 },    //  +1   -1   lỗi (11 -> 00)
+        { 2, 1, 1 },    //  +1   -1   +1
+        { 0, 0, 2 },    //  +1   -1   lỗi (01 -> 10)
+        { 1, 0, 2 },    //  +1    0    0
+        { 3, 0, 2 },    //  +1    0    0
+        { 2, 0, 3 },    //  +1    0   -1
+        { 0, 0, 1 },    //  +1    0   -1
+    };
+
+    Test_Reset(initial);
+    Test_Replay(sequence, sizeof(sequence) / sizeof(sequence[0]));
+
+    TEST_CHECK_EQ(Encoder_GetPosition(0), 8);
+    TEST_CHECK_EQ(Encoder_GetIllegalCount(0), 0);
+    TEST_CHECK_EQ(Encoder_GetPosition(1), -4);
+    TEST_CHECK_EQ(Encoder_GetIllegalCount(1), 0);
+    TEST_CHECK_EQ(Encoder_GetPosition(2), -1);
+    TEST_CHECK_EQ(Encoder_GetIllegalCount(2), 3);
+}
+
+/* Đổi chiều giữa chừng và trạng thái ban đầu khác 00 */
+static void Test_DirectionChange(void)
+{
+    static const uint8 initial[TEST_ENCODERS] = { 3, 2, 1 };
+    static const uint8 sequence[][TEST_ENCODERS] = {
+        { 3, 2, 1 },    //   0    0    0  (giữ nguyên trạng thái lúc Init)
+        { 2, 3, 0 },    //  +1   -1   -1
+        { 0, 1, 2 },    //  +1   -1   -1
+        { 2, 3, 2 },    //  -1   +1    0
+        { 3, 2, 3 },    //  -1   +1   -1
+        { 1, 0, 1 },    //  -1   +1   -1
+        { 1, 0, 0 },    //   0    0   -1
+    };
+
+    Test_Reset(initial);
+    Test_Replay(sequence, sizeof(sequence) / sizeof(sequence[0]));
+
+    TEST_CHECK_EQ(Encoder_GetPosition(0), -1);
+    TEST_CHECK_EQ(Encoder_GetPosition(1), 1);
+    TEST_CHECK_EQ(Encoder_GetPosition(2), -5);
+    TEST_CHECK_EQ(Encoder_GetIllegalCount(0), 0);
+    TEST_CHECK_EQ(Encoder_GetIllegalCount(1), 0);
+    TEST_CHECK_EQ(Encoder_GetIllegalCount(2), 0);
+}
+
+/* Mỗi tick chỉ đọc mỗi port liên quan đúng một lần */
+static void Test_PortReadsPerTick(void)
+{
+    static const uint8 initial[TEST_ENCODERS] = { 0, 0, 0 };
+    static const uint8 sequence[][TEST_ENCODERS] = {
+        { 1, 1, 1 }, { 3, 3, 3 }, { 2, 2, 2 }, { 0, 0, 0 }, { 1, 1, 1 },
+    };
+
+    Test_Reset(initial);
+    for (uint8 p = 0; p < TEST_PORT_COUNT; p++) TestPortReads[p] = 0;
+
+    Test_Replay(sequence, 5);
+
+    TEST_CHECK_EQ(TestPortReads[0], 5);     // port A: encoder 1 và pha B encoder 2
+    TEST_CHECK_EQ(TestPortReads[1], 5);     // port B: encoder 0
+    TEST_CHECK_EQ(TestPortReads[2], 5);     // port C: pha A encoder 2
+    TEST_CHECK_EQ(TestPortReads[3], 0);     // port D: không dùng
+}
+
+static void Test_InvalidAndVersion(void)
+{
+    Std_VersionInfoType version;
+
+    TEST_CHECK_EQ(Encoder_GetPosition(TEST_ENCODERS), 0);
+    TEST_CHECK_EQ(Encoder_GetIllegalCount(TEST_ENCODERS), 0);
+
+    Encoder_GetVersionInfo(&version);
+    TEST_CHECK_EQ(version.moduleID, ENCODER_MODULE_ID);
+    TEST_CHECK_EQ(version.vendorID, ENCODER_VENDOR_ID);
+}
+
+int main(void)
+{
+    Test_ForwardReverseIllegal();
+    Test_DirectionChange();
+    Test_PortReadsPerTick();
+    Test_InvalidAndVersion();
+
+    return TEST_RESULT("Test_Encoder");
+}
@@ -0,0 +1,255 @@
+/***************************************************************************
+ * @file    Test_Keypad.c
+ * @brief   Test bộ quét ma trận phím trên máy host với Dio thật và GPIO giả lập
+ * @details Ma trận 4x4 theo Keypad_Cfg (hàng PB12..15, cột PA8..11) không có
+ *          diode: hàng đang bị kéo xuống (đọc từ BSRR) kéo theo mọi cột và
+ *          hàng nối với nó qua phím nhấn, kể cả đường vòng tạo phím ảo. Mức
+ *          cột được đặt vào GPIOA->IDR trước mỗi lần gọi Keypad_MainFunction.
+ *          Dio_ReadChannelGroup/Dio_WriteChannelGroup được bọc bằng
+ *          -Wl,--wrap để đếm số lần gọi.
+ ***************************************************************************/
+
+#include "Test.h"
+#include "Spl_Sim.h"
+#include "Keypad.h"
+#include "Keypad_Cfg.h"
+
+#define TEST_ROWS       4u
+#define TEST_ROW_SHIFT  12u     // Hàng 0 = PB12
+#define TEST_COL_SHIFT  8u      // Cột 0 = PA8
+
+Dio_PortLevelType __real_Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr);
+void __real_Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+static uint32 ReadCount = 0;
+static uint32 WriteCount = 0;
+
+Dio_PortLevelType __wrap_Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr)
+{
+    ReadCount++;
+    return __real_Dio_ReadChannelGroup(ChannelGroupIdPtr);
+}
+
+void __wrap_Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+    WriteCount++;
+    __real_Dio_WriteChannelGroup(ChannelGroupIdPtr, Level);
+}
+
+/* Phím đang nhấn vật lý: Keys[hàng] = bitmap cột */
+static Keypad_RowBitmapType Keys[TEST_ROWS];
+
+/* Hàng mà test chờ driver kéo xuống ở lần ghi BSRR tiếp theo */
+static uint8 ExpectedRow = 0;
+
+#define TEST_MAX_NOTIFY 16u
+
+static uint8 NotifyCount = 0;
+static uint8 NotifyRow[TEST_MAX_NOTIFY];
+static uint8 NotifyColumn[TEST_MAX_NOTIFY];
+static Keypad_KeyStateType NotifyState[TEST_MAX_NOTIFY];
+
+static void Test_Notification(uint8 Row, uint8 Column, Keypad_KeyStateType State)
+{
+    if (NotifyCount < TEST_MAX_NOTIFY)
+    {
+        NotifyRow[NotifyCount] = Row;
+        NotifyColumn[NotifyCount] = Column;
+        NotifyState[NotifyCount] = State;
+    }
+    NotifyCount++;
+}
+
+static const Keypad_ConfigType TestConfig = {
+    .RowGroup = &KeypadCfg_Rows,
+    .ColumnGroup = &KeypadCfg_Columns,
+    .Notification = Test_Notification
+};
+
+/* Giá trị BSRR khi chỉ hàng Row bị kéo xuống, các hàng khác thả nổi */
+static uint32 Test_RowBsrr(uint8 Row)
+{
+    uint32 reset = (uint32)1u << (TEST_ROW_SHIFT + Row);
+
+    return (reset << 16) | (0xF000u & ~reset);
+}
+
+/* Đặt IDR cột theo hàng đang bị kéo xuống trong BSRR và các phím đang nhấn */
+static void Test_DriveColumns(void)
+{
+    uint8 lowRows = (uint8)((GPIOB->BSRR >> (16u + TEST_ROW_SHIFT)) & 0x0Fu);
+    Keypad_RowBitmapType lowCols = 0;
+    uint8 previous;
+
+    // Lan truyền mức thấp qua phím nhấn: hàng -> cột -> hàng ... tới khi ổn định
+    do
+    {
+        previous = lowRows;
+        for (uint8 row = 0; row < TEST_ROWS; row++)
+        {
+            if (lowRows & (1u << row)) lowCols |= Keys[row];
+        }
+        for (uint8 row = 0; row < TEST_ROWS; row++)
+        {
+            if (Keys[row] & lowCols) lowRows |= (uint8)(1u << row);
+        }
+    } while (lowRows != previous);
+
+    // Bit ngoài nhóm cột để 1 cho chắc driver có lấy mask
+    GPIOA->IDR = 0xFFFFu & ~((uint32)lowCols << TEST_COL_SHIFT);
+}
+
+/* Một lần gọi Keypad_MainFunction: đúng một cặp đọc/ghi nhóm kênh, kéo đúng hàng kế tiếp */
+static void Test_Tick(void)
+{
+    uint32 reads = ReadCount;
+    uint32 writes = WriteCount;
+
+    Test_DriveColumns();
+    Keypad_MainFunction();
+
+    ExpectedRow = (uint8)((ExpectedRow + 1u) % TEST_ROWS);
+    TEST_CHECK_EQ(ReadCount - reads, 1);
+    TEST_CHECK_EQ(WriteCount - writes, 1);
+    TEST_CHECK_EQ(GPIOB->BSRR, Test_RowBsrr(ExpectedRow));
+}
+
+static void Test_Frames(uint8 Frames)
+{
+    for (uint8 i = 0; i < (uint8)(Frames * TEST_ROWS); i++) Test_Tick();
+}
+
+static Keypad_RowBitmapType Test_KeyMapRow(uint8 Row)
+{
+    Keypad_RowBitmapType map[TEST_ROWS];
+
+    TEST_CHECK_EQ(Keypad_GetKeyMap(map), E_OK);
+    return map[Row];
+}
+
+static void Test_Setup(void)
+{
+    Sim_Reset();
+    for (uint8 row = 0; row < TEST_ROWS; row++) Keys[row] = 0;
+    NotifyCount = 0;
+    ExpectedRow = 0;
+
+    Keypad_Init(&TestConfig);
+    TEST_CHECK_EQ(GPIOB->BSRR, Test_RowBsrr(0));
+}
+
+static void Test_ConfirmAfterFourFrames(void)
+{
+    Test_Setup();
+    Keys[1] = 1u << 2;
+
+    // 3 khung và 3/4 khung thứ tư: chưa xác nhận
+    Test_Frames(3);
+    for (uint8 i = 0; i < TEST_ROWS - 1u; i++) Test_Tick();
+    TEST_CHECK_EQ(Test_KeyMapRow(1), 0);
+    TEST_CHECK_EQ(NotifyCount, 0);
+
+    // Lần gọi cuối của khung thứ tư
+    Test_Tick();
+    TEST_CHECK_EQ(Test_KeyMapRow(1), 1u << 2);
+    TEST_CHECK_EQ(NotifyCount, 1);
+    TEST_CHECK_EQ(NotifyRow[0], 1);
+    TEST_CHECK_EQ(NotifyColumn[0], 2);
+    TEST_CHECK_EQ(NotifyState[0], KEYPAD_KEY_PRESSED);
+
+    // Giữ tiếp không sinh thêm sự kiện, nhả cũng cần đủ 4 khung
+    Test_Frames(2);
+    Keys[1] = 0;
+    Test_Frames(3);
+    TEST_CHECK_EQ(Test_KeyMapRow(1), 1u << 2);
+    TEST_CHECK_EQ(NotifyCount, 1);
+    Test_Frames(1);
+    TEST_CHECK_EQ(Test_KeyMapRow(1), 0);
+    TEST_CHECK_EQ(NotifyCount, 2);
+    TEST_CHECK_EQ(NotifyState[1], KEYPAD_KEY_RELEASED);
+}
+
+static void Test_BounceResetsCounter(void)
+{
+    Test_Setup();
+
+    // Nhấn 2 khung, dội nhả 1 khung: bộ đếm về 0
+    Keys[3] = 1u << 0;
+    Test_Frames(2);
+    Keys[3] = 0;
+    Test_Frames(1);
+
+    // Nhấn lại: phải đủ 4 khung mới, không phải 2 khung còn lại
+    Keys[3] = 1u << 0;
+    Test_Frames(3);
+    TEST_CHECK_EQ(Test_KeyMapRow(3), 0);
+    TEST_CHECK_EQ(NotifyCount, 0);
+    Test_Frames(1);
+    TEST_CHECK_EQ(Test_KeyMapRow(3), 1u << 0);
+    TEST_CHECK_EQ(NotifyCount, 1);
+}
+
+static void Test_GhostingHoldsKeyMap(void)
+{
+    Test_Setup();
+
+    Keys[3] = 1u << 3;
+    Test_Frames(4);
+    TEST_CHECK_EQ(NotifyCount, 1);
+    TEST_CHECK(!Keypad_IsGhosting());
+
+    // Ba góc (0,0) (0,1) (1,0) của hình chữ nhật: (1,1) bị đọc thành phím ảo
+    Keys[0] = (1u << 0) | (1u << 1);
+    Keys[1] = 1u << 0;
+    Test_Frames(6);
+    TEST_CHECK(Keypad_IsGhosting());
+    TEST_CHECK_EQ(Test_KeyMapRow(0), 0);
+    TEST_CHECK_EQ(Test_KeyMapRow(1), 0);
+    TEST_CHECK_EQ(Test_KeyMapRow(3), 1u << 3);
+    TEST_CHECK_EQ(NotifyCount, 1);
+
+    // Nhả một góc: hết ghosting, hai phím còn lại được xác nhận sau 4 khung
+    Keys[0] = 1u << 0;
+    Test_Frames(1);
+    TEST_CHECK(!Keypad_IsGhosting());
+    Test_Frames(3);
+    TEST_CHECK_EQ(Test_KeyMapRow(0), 1u << 0);
+    TEST_CHECK_EQ(Test_KeyMapRow(1), 1u << 0);
+    TEST_CHECK_EQ(NotifyCount, 3);
+}
+
+static void Test_OneNotificationPerKey(void)
+{
+    Test_Setup();
+
+    // Ba phím cùng lúc, hai trong cùng một hàng, không tạo hình chữ nhật
+    Keys[0] = 1u << 1;
+    Keys[2] = (1u << 0) | (1u << 3);
+    Test_Frames(4);
+
+    TEST_CHECK(!Keypad_IsGhosting());
+    TEST_CHECK_EQ(NotifyCount, 3);
+    TEST_CHECK_EQ(NotifyRow[0], 0);
+    TEST_CHECK_EQ(NotifyColumn[0], 1);
+    TEST_CHECK_EQ(NotifyRow[1], 2);
+    TEST_CHECK_EQ(NotifyColumn[1], 0);
+    TEST_CHECK_EQ(NotifyRow[2], 2);
+    TEST_CHECK_EQ(NotifyColumn[2], 3);
+    for (uint8 i = 0; i < 3u; i++) TEST_CHECK_EQ(NotifyState[i], KEYPAD_KEY_PRESSED);
+
+    Keys[0] = 0;
+    Keys[2] = 0;
+    Test_Frames(4);
+    TEST_CHECK_EQ(NotifyCount, 6);
+    for (uint8 i = 3; i < 6u; i++) TEST_CHECK_EQ(NotifyState[i], KEYPAD_KEY_RELEASED);
+}
+
+int main(void)
+{
+    Test_ConfirmAfterFourFrames();
+    Test_BounceResetsCounter();
+    Test_GhostingHoldsKeyMap();
+    Test_OneNotificationPerKey();
+
+    return TEST_RESULT("Test_Keypad");
+}
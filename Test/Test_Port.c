@@ -0,0 +1,75 @@
+/***************************************************************************
+ * @file    Test_Port.c
+ * @brief   Test driver Port trên máy host với GPIO/AFIO/EXTI giả lập
+ * @details Mode của từng chân lấy từ GPIO_Init giả lập (Sim_GetPinMode),
+ *          định tuyến EXTI đọc lại từ AFIO->EXTICR và các thanh ghi EXTI.
+ ***************************************************************************/
+
+#include "Test.h"
+#include "Spl_Sim.h"
+#include "Port.h"
+#include "Port_Cfg.h"
+
+#define TEST_LINE(n)    ((uint32)1u << (n))
+
+static void Test_ProjectConfig(void)
+{
+    Sim_Reset();
+    Port_Init(&Port_Config);
+
+    // PA0 là chân ADC: analog, không pull
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOA, 0), GPIO_Mode_AIN);
+
+    // PC13 output push-pull mặc định mức cao
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOC, 13), GPIO_Mode_Out_PP);
+    TEST_CHECK_EQ(GPIOC->ODR & 0x2000u, 0x2000u);
+
+    // Encoder và cột keypad: input kéo lên
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOB, 6), GPIO_Mode_IPU);
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOB, 7), GPIO_Mode_IPU);
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOA, 6), GPIO_Mode_IPU);
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOA, 7), GPIO_Mode_IPU);
+    for (uint8 pin = 8; pin <= 11u; pin++) TEST_CHECK_EQ(Sim_GetPinMode(GPIOA, pin), GPIO_Mode_IPU);
+
+    // Hàng keypad: open-drain, thả nổi (mức cao) sau khi khởi tạo
+    for (uint8 pin = 12; pin <= 15u; pin++) TEST_CHECK_EQ(Sim_GetPinMode(GPIOB, pin), GPIO_Mode_Out_OD);
+    TEST_CHECK_EQ(GPIOB->ODR & 0xF000u, 0xF000u);
+
+    // PB8 nút nhấn: line EXTI 8 nối tới Port B, chỉ bắt cạnh xuống
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOB, 8), GPIO_Mode_IPU);
+    TEST_CHECK_EQ(AFIO->EXTICR[2] & 0x0Fu, GPIO_PortSourceGPIOB);
+    TEST_CHECK_EQ(EXTI->IMR, TEST_LINE(8));
+    TEST_CHECK_EQ(EXTI->FTSR, TEST_LINE(8));
+    TEST_CHECK_EQ(EXTI->RTSR, 0);
+    TEST_CHECK(Sim_IsIrqEnabled(EXTI9_5_IRQn));
+
+    // Chân không cấu hình thì không bị đụng tới
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOD, 2), SIM_PIN_MODE_NONE);
+}
+
+static void Test_AdcPin(void)
+{
+    // Chân ADC khai báo nhầm hướng output, mức cao và có Edge
+    const Port_PinConfigType pin = {
+        .PortID = PORT_ID_C, .PinID = 33, .PinMode = PORT_PIN_MODE_ADC, .Direction = PORT_PIN_OUT,
+        .Speed = GPIO_Speed_2MHz, .Pull = PULL_UP, .Level = PORT_PIN_LEVEL_HIGH,
+        .Edge = PORT_PIN_EDGE_RISING
+    };
+
+    Sim_Reset();
+    Port_Deploy_pin(&pin);
+
+    // Vẫn là analog, không ghi ODR, line EXTI 1 không được bật
+    TEST_CHECK_EQ(Sim_GetPinMode(GPIOC, 1), GPIO_Mode_AIN);
+    TEST_CHECK_EQ(GPIOC->ODR, 0);
+    TEST_CHECK_EQ(EXTI->IMR & TEST_LINE(1), 0);
+    TEST_CHECK(!Sim_IsIrqEnabled(EXTI1_IRQn));
+}
+
+int main(void)
+{
+    Test_ProjectConfig();
+    Test_AdcPin();
+
+    return TEST_RESULT("Test_Port");
+}